@@ -0,0 +1,534 @@
+#include "ChorusCore.h"
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <chrono>
+
+void ChorusCore::prepare(double sampleRate, int samplesPerBlock, int numChannels)
+{
+    currentSampleRate = sampleRate;
+    currentSamplesPerBlock = samplesPerBlock;
+    currentNumChannels = numChannels;
+
+    // Initialize smoothed values
+    smoothedChorus.reset(sampleRate, parameterRampSeconds);
+    smoothedMix.reset(sampleRate, parameterRampSeconds);
+    
+    // Setup per-channel chorus processing
+    chorusChannels.resize(numChannels);
+    for (auto& ch : chorusChannels)
+    {
+        ch.delayBuffer.resize(maxDelayInSamples, 0.0f);
+        ch.smoothedDelay.reset(currentSampleRate, delaySmoothingSeconds);
+        ch.controlRateBlend.reset(currentSampleRate, tierCrossfadeSeconds);
+        ch.lowPassBlend.reset(currentSampleRate, tierCrossfadeSeconds);
+    }
+    
+    // Scratch for the mix stage; larger host blocks are processed in slices
+    wetScratch.assign(static_cast<size_t>(std::max(1, samplesPerBlock)), 0.0f);
+    mixScratch.assign(wetScratch.size(), 0.0f);
+    dryScratch.assign(wetScratch.size(), 0.0f);
+    phaseScratch.assign(wetScratch.size(), 0.0f);
+    lfoScratch.assign(wetScratch.size(), 0.0f);
+    
+    // Pick the fastest kernel variant this CPU supports (unless overridden)
+    activeKernel = SaturatorKernels::resolveIsa(kernelOverride);
+    mixAndClamp = SaturatorKernels::getMixAndClamp(activeKernel);
+    lfoCurve = SaturatorKernels::getLfoCurve(activeKernel);
+    
+    // Stereo LFO advances lfoRateHz cycles per second
+    lfo.prepare(sampleRate, lfoRateHz);
+    
+    seek(0);
+}
+
+void ChorusCore::setPositionDeterministic(bool shouldBeDeterministic)
+{
+    positionDeterministic = shouldBeDeterministic;
+    lfo.setPositionDeterministic(shouldBeDeterministic);
+}
+
+void ChorusCore::seek(std::int64_t newSamplePosition)
+{
+    lfo.seek(std::max(static_cast<std::int64_t>(0), newSamplePosition));
+    
+    resetProcessingState();
+}
+
+int ChorusCore::getWarmupLengthSamples() const
+{
+    // The delay line must be refilled and the DC blocker's history must decay to its flush
+    // threshold. seek() snaps the parameter smoothers to their targets, so they need none.
+    return maxDelayInSamples + dcBlockerSettleSamples;
+}
+
+void ChorusCore::resetProcessingState()
+{
+    smoothedChorus.setCurrentAndTargetValue(chorus.load());
+    smoothedMix.setCurrentAndTargetValue(mix.load());
+    
+    for (auto& ch : chorusChannels)
+    {
+        std::fill(ch.delayBuffer.begin(), ch.delayBuffer.end(), 0.0f);
+        ch.writeIndex = 0;
+        ch.prevSample = 0.0f;
+        ch.dcBlocker_x1 = 0.0f;
+        ch.dcBlocker_y1 = 0.0f;
+        ch.lpf_state = 0.0f;
+        
+        // Initialize smoothed delay for each channel to prevent artifacts
+        ch.smoothedDelay.setCurrentAndTargetValue(minDelayMs);
+        ch.controlDelayMs = minDelayMs;
+        ch.controlDelayStep = 0.0f;
+        ch.controlCountdown = 0;
+    }
+    
+    // Deterministic renders always run at full quality; otherwise keep the governor's tier
+    applyProcessingTier(positionDeterministic ? ProcessingTier::Full : getProcessingTier(), false);
+}
+
+void ChorusCore::setGovernorThreshold(float fractionOfBudget)
+{
+    governorThreshold.store(std::max(0.0f, fractionOfBudget));
+}
+
+void ChorusCore::updateGovernor(double elapsedSeconds, int numSamples)
+{
+    const double budgetSeconds = static_cast<double>(numSamples) / currentSampleRate;
+    // Capped so a single preempted or page-faulting block cannot drag the smoothed load over
+    // the threshold on its own; sustained overload still gets there within a few blocks
+    const float blockLoad = std::min(static_cast<float>(elapsedSeconds / budgetSeconds), governorMaxBlockLoad);
+    
+    const float previousLoad = cpuLoad.load();
+    const float smoothedLoad = previousLoad + cpuLoadSmoothing * (blockLoad - previousLoad);
+    cpuLoad.store(smoothedLoad);
+    
+    // Offline deterministic renders have no real-time budget and need fixed strategies
+    const float threshold = governorThreshold.load();
+    const auto tier = getProcessingTier();
+    if (positionDeterministic || threshold <= 0.0f)
+    {
+        if (tier != ProcessingTier::Full && !positionDeterministic)
+            applyProcessingTier(ProcessingTier::Full, true);
+        return;
+    }
+    
+    samplesSinceTierChange += numSamples;
+    const double secondsSinceChange = static_cast<double>(samplesSinceTierChange) / currentSampleRate;
+    
+    // The quiet spell restarts whenever the load rises above the recovery level again,
+    // so periodic spikes keep the engine on the cheaper tier instead of flapping
+    if (smoothedLoad < threshold * governorRecoveryRatio)
+        samplesBelowRecovery += numSamples;
+    else
+        samplesBelowRecovery = 0;
+    
+    const double secondsBelowRecovery = static_cast<double>(samplesBelowRecovery) / currentSampleRate;
+    
+    // Step down quickly when overloaded, step back up only after a long quiet spell
+    if (smoothedLoad > threshold && tier != ProcessingTier::Minimal
+        && secondsSinceChange >= governorDegradeHoldSeconds)
+    {
+        applyProcessingTier(static_cast<ProcessingTier>(static_cast<int>(tier) + 1), true);
+    }
+    else if (tier != ProcessingTier::Full && secondsBelowRecovery >= governorRecoverHoldSeconds)
+    {
+        applyProcessingTier(static_cast<ProcessingTier>(static_cast<int>(tier) - 1), true);
+    }
+}
+
+void ChorusCore::applyProcessingTier(ProcessingTier tier, bool crossfade)
+{
+    processingTier.store(static_cast<int>(tier));
+    samplesSinceTierChange = 0;
+    samplesBelowRecovery = 0;
+    
+    const float controlRateTarget = tier != ProcessingTier::Full ? 1.0f : 0.0f;
+    const float lowPassTarget = tier == ProcessingTier::Minimal ? 0.0f : 1.0f;
+    
+    for (auto& ch : chorusChannels)
+    {
+        // Hand the delay time over so the strategy fading in starts where the other one is
+        if (!ch.controlRateBlend.isSmoothing())
+        {
+            if (ch.controlRateBlend.getCurrentValue() < 0.5f)
+            {
+                ch.controlDelayMs = ch.smoothedDelay.getCurrentValue();
+                ch.controlDelayStep = 0.0f;
+                ch.controlCountdown = 0;
+            }
+            else
+            {
+                ch.smoothedDelay.setCurrentAndTargetValue(ch.controlDelayMs);
+            }
+        }
+        
+        if (crossfade)
+        {
+            ch.controlRateBlend.setTargetValue(controlRateTarget);
+            ch.lowPassBlend.setTargetValue(lowPassTarget);
+        }
+        else
+        {
+            ch.controlRateBlend.setCurrentAndTargetValue(controlRateTarget);
+            ch.lowPassBlend.setCurrentAndTargetValue(lowPassTarget);
+        }
+    }
+}
+
+void ChorusCore::process(const AudioBufferView& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = std::min(buffer.getNumChannels(), static_cast<int>(chorusChannels.size()));
+
+    // Safety checks
+    if (numSamples <= 0 || numChannels <= 0 || mixAndClamp == nullptr || lfoCurve == nullptr)
+        return;
+
+    const auto blockStartTime = std::chrono::steady_clock::now();
+
+    // Update smoothed parameters
+    smoothedChorus.setTargetValue(chorus.load());
+    smoothedMix.setTargetValue(mix.load());
+
+    const int sliceCapacity = static_cast<int>(wetScratch.size());
+    const int stride = buffer.getStride();
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        float* channelData = buffer.getChannel(channel);
+
+        for (int sliceStart = 0; sliceStart < numSamples; sliceStart += sliceCapacity)
+        {
+            const int sliceLength = std::min(sliceCapacity, numSamples - sliceStart);
+            float* sliceData = channelData + sliceStart * stride;
+
+            // The mix kernels want contiguous samples, so strided channels go through scratch
+            float* dry = sliceData;
+            if (stride != 1)
+            {
+                dry = dryScratch.data();
+                for (int i = 0; i < sliceLength; ++i)
+                    dry[i] = sliceData[i * stride];
+            }
+
+            // Vectorised stage: the LFO curve only depends on the sample position, so the phase
+            // and sine for the whole slice are evaluated up front instead of in the recursion
+            lfoCurve(lfo.getPhaseOrigin(), lfo.getPhaseIndex(sliceStart), lfo.getPhaseIncrement(),
+                     getLfoPhaseOffset(channel), phaseScratch.data(), lfoScratch.data(), sliceLength);
+
+            // Sequential stage: the chorus recursion (delay line, filters, smoothers)
+            for (int i = 0; i < sliceLength; ++i)
+            {
+                const float inputSample = dry[i];
+
+                // Skip processing if input is not finite (the mix stage turns it into silence)
+                if (!std::isfinite(inputSample))
+                {
+                    wetScratch[i] = inputSample;
+                    mixScratch[i] = 0.0f;
+                    continue;
+                }
+
+                const float currentChorus = smoothedChorus.getNextValue();
+                const float currentMix = smoothedMix.getNextValue();
+
+                // Apply high-quality chorus effect
+                float chorusProcessedSample = inputSample;
+                
+                if (currentChorus > 0.001f) // Only apply chorus if there's a meaningful amount
+                {
+                    chorusProcessedSample = processHighQualityChorus(inputSample, channel, currentChorus,
+                                                                     phaseScratch[i], lfoScratch[i]);
+                }
+
+                wetScratch[i] = chorusProcessedSample;
+                mixScratch[i] = currentMix;
+            }
+
+            // Vectorised stage: mix dry and wet (chorus) signals, clamp and ensure finite
+            mixAndClamp(dry, wetScratch.data(), mixScratch.data(), dry, sliceLength);
+
+            if (stride != 1)
+                for (int i = 0; i < sliceLength; ++i)
+                    sliceData[i * stride] = dry[i];
+        }
+    }
+    
+    // Advance the stream position and the LFO to the start of the next block
+    lfo.advance(numSamples);
+    
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - blockStartTime;
+    updateGovernor(elapsed.count(), numSamples);
+}
+
+void ChorusCore::processBypassed(const AudioBufferView& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = std::min(buffer.getNumChannels(), static_cast<int>(chorusChannels.size()));
+
+    if (numSamples <= 0)
+        return;
+
+    const int stride = buffer.getStride();
+    const int delaySmoothingSamples = static_cast<int>(delaySmoothingSeconds * currentSampleRate);
+
+    // Bypass outputs the dry signal, i.e. a mix of zero: park the mix there so that the first
+    // processed block ramps the wet signal back in over parameterRampSeconds instead of
+    // stepping to it. The chorus amount resumes from its current value.
+    smoothedChorus.setCurrentAndTargetValue(chorus.load());
+    smoothedMix.setCurrentAndTargetValue(0.0f);
+
+    // The LFO only depends on the phase, so it can jump straight to the end of the block
+    lfo.advance(numSamples);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        auto& ch = chorusChannels[channel];
+        const float* channelData = buffer.getChannel(channel);
+
+        writeToDelayLine(ch, channelData, stride, numSamples);
+
+        // Audio is assumed DC-free, so the DC blocker's output tracks its input
+        const float lastSample = channelData[(numSamples - 1) * stride];
+        if (std::isfinite(lastSample))
+        {
+            ch.dcBlocker_x1 = lastSample;
+            ch.dcBlocker_y1 = lastSample;
+        }
+
+        // Delay and low-pass resume where the next processed sample will read. Chasing a new
+        // target every sample, the delay smoother trails the LFO by about its smoothing time.
+        const double phase = positionDeterministic ? lfo.getPhase(0) : lfo.getPhase(-delaySmoothingSamples);
+        const float targetDelayMs = getTargetDelayMs(smoothedChorus.getTargetValue(), getLfoValue(phase, channel));
+        ch.smoothedDelay.setCurrentAndTargetValue(targetDelayMs);
+        ch.controlDelayMs = getTargetDelayMs(smoothedChorus.getTargetValue(), getLfoValue(lfo.getPhase(0), channel));
+        ch.controlDelayStep = 0.0f;
+        ch.controlCountdown = 0;
+
+        const int bufferSize = static_cast<int>(ch.delayBuffer.size());
+        const int delaySamples = std::clamp(static_cast<int>((targetDelayMs / 1000.0f) * static_cast<float>(currentSampleRate)),
+                                            1, bufferSize - 1);
+        const float delayedSample = ch.delayBuffer[(ch.writeIndex - delaySamples + bufferSize) % bufferSize];
+        ch.lpf_state = std::isfinite(delayedSample) ? delayedSample : 0.0f;
+    }
+}
+
+void ChorusCore::writeToDelayLine(ChorusChannel& ch, const float* samples, int stride, int numSamples)
+{
+    const int bufferSize = static_cast<int>(ch.delayBuffer.size());
+
+    // Only the newest bufferSize samples survive in the ring
+    const int numToWrite = std::min(numSamples, bufferSize);
+    const float* source = samples + (numSamples - numToWrite) * stride;
+    const int startIndex = (ch.writeIndex + (numSamples - numToWrite)) % bufferSize;
+
+    // At most two contiguous segments: up to the end of the ring, then from its start
+    const int firstSegment = std::min(numToWrite, bufferSize - startIndex);
+
+    if (stride == 1)
+    {
+        std::memcpy(ch.delayBuffer.data() + startIndex, source, sizeof(float) * static_cast<size_t>(firstSegment));
+        std::memcpy(ch.delayBuffer.data(), source + firstSegment, sizeof(float) * static_cast<size_t>(numToWrite - firstSegment));
+    }
+    else
+    {
+        for (int i = 0; i < firstSegment; ++i)
+            ch.delayBuffer[static_cast<size_t>(startIndex + i)] = source[i * stride];
+
+        for (int i = firstSegment; i < numToWrite; ++i)
+            ch.delayBuffer[static_cast<size_t>(i - firstSegment)] = source[i * stride];
+    }
+
+    ch.writeIndex = (ch.writeIndex + numSamples) % bufferSize;
+}
+
+float ChorusCore::getLfoPhaseOffset(int channel)
+{
+    // Stereo LFO: right channel runs 90° ahead for width
+    return channel == 0 ? 0.0f : 0.25f;
+}
+
+float ChorusCore::getLfoValue(double phase, int channel)
+{
+    return SaturatorKernels::lfoSine(static_cast<float>(phase), getLfoPhaseOffset(channel));
+}
+
+float ChorusCore::getTargetDelayMs(float chorusAmount, float lfoValue) const
+{
+    // Calculate modulated delay time with professional scaling
+    const float delayRange = (maxDelayMs - minDelayMs) * 0.5f;
+    const float centerDelay = minDelayMs + delayRange;
+    const float modulationDepth = delayRange * chorusAmount * lfoDepthScale;
+    return centerDelay + (lfoValue * modulationDepth);
+}
+
+float ChorusCore::getSmoothedDelayMs(ChorusChannel& ch, float chorusAmount, float lfoValue)
+{
+    ch.smoothedDelay.setTargetValue(getTargetDelayMs(chorusAmount, lfoValue));
+    return ch.smoothedDelay.getNextValue();
+}
+
+float ChorusCore::getControlRateDelayMs(ChorusChannel& ch, float chorusAmount, float phase, int channel)
+{
+    // Evaluate the LFO once per interval and ramp linearly towards its value at the next update
+    if (ch.controlCountdown <= 0)
+    {
+        const double nextPhase = phase + controlRateInterval * lfo.getPhaseIncrement();
+        const float nextDelayMs = getTargetDelayMs(chorusAmount, getLfoValue(nextPhase, channel));
+        ch.controlDelayStep = (nextDelayMs - ch.controlDelayMs) / static_cast<float>(controlRateInterval);
+        ch.controlCountdown = controlRateInterval;
+    }
+    
+    --ch.controlCountdown;
+    ch.controlDelayMs += ch.controlDelayStep;
+    return ch.controlDelayMs;
+}
+
+// High-quality chorus processing (based on professional implementations)
+float ChorusCore::processHighQualityChorus(float inputSample, int channel, float chorusAmount, float phase, float lfoValue)
+{
+    auto& ch = chorusChannels[channel];
+    
+    // Apply DC blocking first for clean sound
+    float cleanSample = dcBlocker(inputSample, channel);
+    
+    // Use smoothed delay to prevent artifacts. The smoother carries unbounded history, so
+    // deterministic mode follows the (already smooth) LFO curve directly instead.
+    // Under CPU load the governor crossfades to a cheaper control-rate delay ramp.
+    float smoothedDelayMs;
+    if (positionDeterministic)
+    {
+        smoothedDelayMs = getTargetDelayMs(chorusAmount, lfoValue);
+        ch.smoothedDelay.setCurrentAndTargetValue(smoothedDelayMs);
+    }
+    else
+    {
+        const float controlRateAmount = ch.controlRateBlend.getNextValue();
+        
+        if (controlRateAmount <= 0.0f)
+        {
+            smoothedDelayMs = getSmoothedDelayMs(ch, chorusAmount, lfoValue);
+        }
+        else if (controlRateAmount >= 1.0f)
+        {
+            smoothedDelayMs = getControlRateDelayMs(ch, chorusAmount, phase, channel);
+        }
+        else
+        {
+            const float perSampleMs = getSmoothedDelayMs(ch, chorusAmount, lfoValue);
+            const float controlRateMs = getControlRateDelayMs(ch, chorusAmount, phase, channel);
+            smoothedDelayMs = perSampleMs + controlRateAmount * (controlRateMs - perSampleMs);
+        }
+    }
+    
+    // Convert to samples with proper bounds checking
+    const float delaySamples = std::clamp((smoothedDelayMs / 1000.0f) * static_cast<float>(currentSampleRate),
+                                          1.0f, static_cast<float>(maxDelayInSamples - 1));
+    
+    // Apply high-quality linear interpolation
+    const float delayedSample = linearInterpolation(delaySamples, channel, cleanSample);
+    
+    // Mix dry and wet signals with proper gain compensation
+    const float dryGain = 1.0f - (chorusAmount * 0.3f); // Slight dry reduction for depth
+    const float wetGain = chorusAmount * 0.6f; // Wet gain for effect strength
+    
+    return inputSample * dryGain + delayedSample * wetGain;
+}
+
+// High-quality linear interpolation (more stable than all-pass for modulated delays)
+float ChorusCore::linearInterpolation(float delayInSamples, int channel, float inputSample)
+{
+    auto& ch = chorusChannels[channel];
+    
+    // Write input sample to delay buffer
+    ch.delayBuffer[ch.writeIndex] = inputSample;
+    
+    // Calculate integer and fractional parts of delay (the caller clamps it to
+    // [1, bufferSize - 1], so truncation is floor and each read index wraps at most once)
+    const int integerDelay = static_cast<int>(delayInSamples);
+    const float fractionalDelay = delayInSamples - integerDelay;
+    
+    // Calculate read indices with proper bounds checking
+    const int bufferSize = static_cast<int>(ch.delayBuffer.size());
+    int readIndex1 = ch.writeIndex - integerDelay;
+    if (readIndex1 < 0)
+        readIndex1 += bufferSize;
+    int readIndex2 = readIndex1 - 1;
+    if (readIndex2 < 0)
+        readIndex2 += bufferSize;
+    
+    // Get samples for interpolation
+    const float sample1 = ch.delayBuffer[readIndex1];
+    const float sample2 = ch.delayBuffer[readIndex2];
+    
+    // Linear interpolation with anti-aliasing low-pass filter
+    float interpolated = sample1 * (1.0f - fractionalDelay) + sample2 * fractionalDelay;
+    
+    // Simple one-pole low-pass filter for anti-aliasing (cutoff at ~8kHz),
+    // faded out by the governor's Minimal tier
+    const float lpfCutoff = 0.7f;
+    const float lowPassAmount = ch.lowPassBlend.getNextValue();
+    float output = interpolated;
+    
+    if (lowPassAmount > 0.0f)
+    {
+        ch.lpf_state = ch.lpf_state + lpfCutoff * (interpolated - ch.lpf_state);
+        output = lowPassAmount >= 1.0f ? ch.lpf_state
+                                       : interpolated + lowPassAmount * (ch.lpf_state - interpolated);
+    }
+    else
+    {
+        // Keep the filter primed so it can fade back in without a step
+        ch.lpf_state = interpolated;
+    }
+    
+    // Update write index
+    if (++ch.writeIndex == bufferSize)
+        ch.writeIndex = 0;
+    
+    // Ensure output is finite (and don't let a bad sample latch the filter)
+    if (!std::isfinite(output))
+    {
+        ch.lpf_state = 0.0f;
+        return inputSample;
+    }
+    
+    return output;
+}
+
+// DC blocking filter for clean sound
+float ChorusCore::dcBlocker(float inputSample, int channel)
+{
+    auto& ch = chorusChannels[channel];
+    
+    // High-pass filter: y[n] = x[n] - x[n-1] + 0.995 * y[n-1]
+    float output = inputSample - ch.dcBlocker_x1 + 0.995f * ch.dcBlocker_y1;
+    
+    // Flush the decaying tail to zero: otherwise it shrinks through tiny and denormal values
+    // forever and never matches the state of a render started from silence
+    if (std::abs(output) < dcBlockerFlushThreshold)
+        output = 0.0f;
+    
+    ch.dcBlocker_x1 = inputSample;
+    ch.dcBlocker_y1 = output;
+    
+    // Ensure output is finite
+    if (!std::isfinite(output))
+        return inputSample;
+    
+    return output;
+}
+
+// Parameter setters in new order: Chorus → Drive → Mix → Output
+void ChorusCore::setChorus(float newChorus)
+{
+    chorus.store(std::clamp(newChorus, 0.0f, 1.0f));
+}
+
+void ChorusCore::setMix(float newMix)
+{
+    mix.store(std::clamp(newMix, 0.0f, 1.0f));
+}
+
+ 
\ No newline at end of file
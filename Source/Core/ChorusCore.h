@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "ChorusTypes.h"
+#include "SaturatorKernels.h"
+
+// JUCE-free Santa Chorus DSP. Processes caller-owned planar or interleaved audio in place;
+// SaturatorEngine adapts it to juce::AudioBuffer and the C API in santa_chorus.h wraps it
+// for embedding outside the plugin.
+class ChorusCore
+{
+public:
+    // Processing strategies the CPU governor steps through under load
+    enum class ProcessingTier
+    {
+        Full = 0,        // Per-sample LFO and smoothed delay, anti-aliasing low-pass
+        ControlRate,     // LFO and delay time updated every controlRateInterval samples
+        Minimal          // Control-rate modulation without the low-pass stage
+    };
+
+    void prepare(double sampleRate, int samplesPerBlock, int numChannels);
+    void process(const AudioBufferView& buffer);
+
+    // Warm bypass: leaves the buffer untouched but keeps delay lines, filters and the LFO
+    // running so that un-bypassing is click-free
+    void processBypassed(const AudioBufferView& buffer);
+
+    // Parameter setters: Chorus and Dry/Wet mix
+    void setChorus(float newChorus);
+    void setMix(float newMix);
+
+    // Position-deterministic mode for chunked offline rendering: modulation becomes a pure
+    // function of the absolute sample position. Call before prepare() or between renders.
+    void setPositionDeterministic(bool shouldBeDeterministic);
+    bool isPositionDeterministic() const { return positionDeterministic; }
+
+    // Clears all processing history and moves the engine to an absolute sample position
+    void seek(std::int64_t newSamplePosition);
+    std::int64_t getSamplePosition() const { return lfo.getPosition(); }
+
+    // Pre-roll to process (and discard) after seek() before output matches a serial render
+    int getWarmupLengthSamples() const;
+
+    // Forces a kernel variant (for testing); Auto picks the best one for this CPU at prepare()
+    void setKernelOverride(SaturatorKernels::Isa isa) { kernelOverride = isa; }
+    SaturatorKernels::Isa getActiveKernel() const { return activeKernel; }
+
+    // Adaptive CPU governor: when the smoothed per-block cost exceeds this fraction of the
+    // real-time budget the engine steps down to cheaper modulation (0 disables it)
+    static constexpr float defaultGovernorThreshold = 0.8f;
+    void setGovernorThreshold(float fractionOfBudget);
+    ProcessingTier getProcessingTier() const { return static_cast<ProcessingTier>(processingTier.load()); }
+
+    // Smoothed processing cost as a fraction of the real-time budget
+    float getCpuLoad() const { return cpuLoad.load(); }
+
+private:
+
+    // High-quality chorus processing (based on professional implementations)
+    struct ChorusChannel
+    {
+        // Delay line buffer (larger for better quality)
+        std::vector<float> delayBuffer;
+        int writeIndex = 0;
+
+        // Linear interpolation state (more stable than all-pass for modulated delays)
+        float prevSample = 0.0f;
+
+        // Smoothed delay parameter to avoid artifacts
+        LinearSmoother smoothedDelay;
+
+        // DC blocker for clean sound
+        float dcBlocker_x1 = 0.0f;
+        float dcBlocker_y1 = 0.0f;
+
+        // Low-pass filter for anti-aliasing
+        float lpf_state = 0.0f;
+
+        // Control-rate delay ramp used by the cheaper governor tiers
+        float controlDelayMs = 0.0f;
+        float controlDelayStep = 0.0f;
+        int controlCountdown = 0;
+
+        // Crossfades between governor strategies
+        LinearSmoother controlRateBlend; // 0 = per-sample delay, 1 = control rate
+        LinearSmoother lowPassBlend;     // 1 = low-pass on, 0 = bypassed
+    };
+
+    // Per-channel chorus processing
+    std::vector<ChorusChannel> chorusChannels;
+
+    // Stereo LFO and absolute stream position
+    ChorusLfo lfo;
+    bool positionDeterministic = false;
+
+    // Clears delay lines, filters and snaps smoothers to their targets
+    void resetProcessingState();
+
+    // Stereo LFO phase offset (in cycles) and single-sample value, matching the lfoCurve kernels
+    static float getLfoPhaseOffset(int channel);
+    static float getLfoValue(double phase, int channel);
+
+    // Modulated delay time for the given chorus amount and LFO value
+    float getTargetDelayMs(float chorusAmount, float lfoValue) const;
+
+    // Bulk write of a block of (possibly strided) samples into a channel's delay line
+    void writeToDelayLine(ChorusChannel& ch, const float* samples, int stride, int numSamples);
+
+    // Per-sample and control-rate delay times (the latter for the cheaper governor tiers)
+    float getSmoothedDelayMs(ChorusChannel& ch, float chorusAmount, float lfoValue);
+    float getControlRateDelayMs(ChorusChannel& ch, float chorusAmount, float phase, int channel);
+
+    // Measures the block cost against the real-time budget and picks a processing tier
+    void updateGovernor(double elapsedSeconds, int numSamples);
+    void applyProcessingTier(ProcessingTier tier, bool crossfade);
+
+    // High-quality interpolation
+    float linearInterpolation(float delayInSamples, int channel, float inputSample);
+
+    // Professional chorus processing
+    float processHighQualityChorus(float inputSample, int channel, float chorusAmount, float phase, float lfoValue);
+
+    // DC blocking filter
+    float dcBlocker(float inputSample, int channel);
+
+    // Parameters
+    std::atomic<float> chorus{ 0.5f };
+    std::atomic<float> mix{ 0.5f };
+
+    // Processing variables
+    double currentSampleRate = 44100.0;
+    int currentSamplesPerBlock = 512;
+    int currentNumChannels = 2;
+
+    // Kernel variants dispatched once in prepare()
+    SaturatorKernels::Isa kernelOverride = SaturatorKernels::Isa::Auto;
+    SaturatorKernels::Isa activeKernel = SaturatorKernels::Isa::Auto; // Resolved in prepare()
+    SaturatorKernels::MixAndClampFn mixAndClamp = nullptr;
+    SaturatorKernels::LfoCurveFn lfoCurve = nullptr;
+
+    // Per-sample wet signal and mix amount, consumed by the vectorised mix stage.
+    // Strided (interleaved) channels are gathered into the dry scratch around it.
+    std::vector<float> wetScratch;
+    std::vector<float> mixScratch;
+    std::vector<float> dryScratch;
+
+    // LFO phase and value per sample of the current slice, from the vectorised LFO stage
+    std::vector<float> phaseScratch;
+    std::vector<float> lfoScratch;
+
+    // Adaptive CPU governor state
+    std::atomic<float> governorThreshold{ defaultGovernorThreshold };
+    std::atomic<int> processingTier{ static_cast<int>(ProcessingTier::Full) };
+    std::atomic<float> cpuLoad{ 0.0f };
+    std::int64_t samplesSinceTierChange = 0;
+    std::int64_t samplesBelowRecovery = 0;   // Uninterrupted time below threshold * governorRecoveryRatio
+
+    // Smoothed parameters to avoid zipper noise
+    LinearSmoother smoothedChorus;
+    LinearSmoother smoothedMix;
+
+    // Professional chorus parameters (based on high-quality implementations)
+    static constexpr int maxDelayInSamples = 1764;  // 40ms at 44.1kHz
+    static constexpr float minDelayMs = 2.5f;       // Minimum delay: 2.5ms (prevents flanging)
+    static constexpr float maxDelayMs = 15.0f;      // Maximum delay: 15ms (classic chorus range)
+    static constexpr float lfoRateHz = 0.5f;        // 0.5 Hz (classic chorus rate)
+    static constexpr float lfoDepthScale = 0.8f;    // Maximum LFO depth scaling
+    static constexpr double parameterRampSeconds = 0.05; // Chorus / Mix smoothing time
+    static constexpr double delaySmoothingSeconds = 0.02; // Per-channel delay smoothing time
+    static constexpr float dcBlockerFlushThreshold = 1.0e-15f; // DC blocker state below this becomes 0
+    static constexpr int dcBlockerSettleSamples = 8192;  // 0.995^n decays a full-scale step below the flush threshold
+
+    // CPU governor tuning
+    static constexpr int controlRateInterval = 32;             // Samples between control-rate LFO updates
+    static constexpr double tierCrossfadeSeconds = 0.05;       // Crossfade between processing strategies
+    static constexpr float governorRecoveryRatio = 0.5f;       // Step back up below threshold * ratio
+    static constexpr double governorDegradeHoldSeconds = 0.1;  // Minimum time between step-downs
+    static constexpr double governorRecoverHoldSeconds = 2.0;  // Quiet time required before stepping back up
+    static constexpr float cpuLoadSmoothing = 0.1f;            // Per-block weight of the newest measurement
+    static constexpr float governorMaxBlockLoad = 2.0f;        // Cap on one block's load before smoothing
+};
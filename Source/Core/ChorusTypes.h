@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Minimal building blocks of the JUCE-free chorus core: a linear parameter smoother,
+// the chorus LFO phase and a non-owning view onto planar or interleaved audio.
+
+// Linear ramp towards a target value (same stepping as juce::SmoothedValue<float>)
+class LinearSmoother
+{
+public:
+    void reset(double sampleRate, double rampLengthInSeconds)
+    {
+        stepsToTarget = static_cast<int>(std::floor(rampLengthInSeconds * sampleRate));
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float newValue)
+    {
+        target = currentValue = newValue;
+        countdown = 0;
+    }
+
+    void setTargetValue(float newValue)
+    {
+        if (newValue == target)
+            return;
+
+        if (stepsToTarget <= 0)
+        {
+            setCurrentAndTargetValue(newValue);
+            return;
+        }
+
+        target = newValue;
+        countdown = stepsToTarget;
+        step = (target - currentValue) / static_cast<float>(countdown);
+    }
+
+    float getNextValue()
+    {
+        if (!isSmoothing())
+            return target;
+
+        --countdown;
+
+        if (isSmoothing())
+            currentValue += step;
+        else
+            currentValue = target;
+
+        return currentValue;
+    }
+
+    bool isSmoothing() const { return countdown > 0; }
+    float getCurrentValue() const { return currentValue; }
+    float getTargetValue() const { return target; }
+
+private:
+    float currentValue = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
+
+// Phase of the chorus LFO in cycles (the sine itself is evaluated by the SaturatorKernels).
+// In position-deterministic mode the phase is derived from the absolute sample position
+// instead of being accumulated.
+class ChorusLfo
+{
+public:
+    void prepare(double sampleRate, float rateHz)
+    {
+        phaseIncrement = static_cast<double>(rateHz) / sampleRate;
+    }
+
+    void setPositionDeterministic(bool shouldBeDeterministic) { positionDeterministic = shouldBeDeterministic; }
+
+    // Moves to an absolute sample position; a free-running LFO restarts from zero
+    void seek(std::int64_t newPosition)
+    {
+        position = newPosition;
+        phase = positionDeterministic ? getPhase(0) : 0.0;
+    }
+
+    // Phase in cycles [0, 1) for a sample relative to the current position
+    double getPhase(int sampleOffset) const
+    {
+        const double cycles = getPhaseOrigin() + getPhaseIndex(sampleOffset) * phaseIncrement;
+        return cycles - std::floor(cycles);
+    }
+
+    // The unwrapped phase of a sample is getPhaseOrigin() + getPhaseIndex(offset) * increment.
+    // Deterministic mode derives every sample's phase from its absolute position, so the
+    // result does not depend on how the render was split into blocks or chunks.
+    double getPhaseOrigin() const { return positionDeterministic ? 0.0 : phase; }
+
+    double getPhaseIndex(int sampleOffset) const
+    {
+        return static_cast<double>(positionDeterministic ? position + sampleOffset : sampleOffset);
+    }
+
+    // O(1) regardless of the number of samples
+    void advance(int numSamples)
+    {
+        phase = getPhase(numSamples);
+        position += numSamples;
+    }
+
+    double getPhaseIncrement() const { return phaseIncrement; }
+    std::int64_t getPosition() const { return position; }
+
+private:
+    double phase = 0.0;
+    double phaseIncrement = 0.0;
+    std::int64_t position = 0;
+    bool positionDeterministic = false;
+};
+
+// Non-owning view onto caller memory: either one pointer per channel (planar) or a
+// single interleaved block. Processing happens in place without copying the audio.
+class AudioBufferView
+{
+public:
+    AudioBufferView(float* const* channelPointers, int channels, int samples)
+        : planar(channelPointers), numChannels(channels), numSamples(samples) {}
+
+    static AudioBufferView fromInterleaved(float* data, int channels, int frames)
+    {
+        AudioBufferView view(nullptr, channels, frames);
+        view.interleaved = data;
+        return view;
+    }
+
+    int getNumChannels() const { return numChannels; }
+    int getNumSamples() const { return numSamples; }
+
+    // First sample of a channel and the distance between its consecutive samples
+    float* getChannel(int channel) const { return planar != nullptr ? planar[channel] : interleaved + channel; }
+    int getStride() const { return planar != nullptr ? 1 : numChannels; }
+
+private:
+    float* const* planar = nullptr;
+    float* interleaved = nullptr;
+    int numChannels = 0;
+    int numSamples = 0;
+};
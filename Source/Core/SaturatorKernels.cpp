@@ -0,0 +1,540 @@
+#include "SaturatorKernels.h"
+#include <cmath>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+ #define SATURATOR_KERNELS_X86 1
+ #include <immintrin.h>
+ #if defined(_MSC_VER) && ! defined(__clang__)
+  #include <intrin.h>
+  // MSVC accepts any intrinsic without per-function target flags
+  #define SATURATOR_TARGET_AVX2
+  #define SATURATOR_TARGET_AVX512
+ #else
+  #define SATURATOR_TARGET_AVX2   __attribute__((target("avx2")))
+  #define SATURATOR_TARGET_AVX512 __attribute__((target("avx512f")))
+ #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+ #define SATURATOR_KERNELS_NEON 1
+ #include <arm_neon.h>
+#endif
+
+namespace SaturatorKernels
+{
+namespace
+{
+    // Scalar reference, also used for the tails of the vector variants
+    inline float mixAndClampSample(float dry, float wet, float mix)
+    {
+        const float output = dry * (1.0f - mix) + wet * mix;
+
+        if (!std::isfinite(output))
+            return 0.0f;
+
+        return std::min(1.0f, std::max(-1.0f, output));
+    }
+
+    void mixAndClampScalar(const float* dry, const float* wet, const float* mix, float* out, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            out[i] = mixAndClampSample(dry[i], wet[i], mix[i]);
+    }
+
+    // Taylor coefficients of sin(2 * pi * y), accurate to ~1e-7 for |y| <= 0.25
+    constexpr float sinC1 = 6.28318531f;
+    constexpr float sinC3 = -41.3417022f;
+    constexpr float sinC5 = 81.6052493f;
+    constexpr float sinC7 = -76.7058598f;
+    constexpr float sinC9 = 42.0586939f;
+    constexpr float sinC11 = -15.0946426f;
+
+    // Scalar reference of the LFO curve; the vector variants repeat these steps lane by lane
+    inline float lfoSineSample(float phase, float offsetCycles)
+    {
+        // Reduce to [-0.5, 0.5) cycles (truncation is floor for the non-negative input),
+        // then fold onto [-0.25, 0.25] where the polynomial is accurate
+        float x = phase + offsetCycles;
+        x = x - static_cast<float>(static_cast<int>(x + 0.5f));
+
+        float y = std::min(x, 0.5f - x);
+        y = std::max(y, -0.5f - y);
+
+        const float z = y * y;
+        float p = sinC11;
+        p = p * z + sinC9;
+        p = p * z + sinC7;
+        p = p * z + sinC5;
+        p = p * z + sinC3;
+        p = p * z + sinC1;
+        return y * p;
+    }
+
+    // Fractional part of originCycles + index * cyclesPerSample (truncation is floor for the
+    // non-negative phases of the LFO)
+    inline float lfoPhaseSample(double originCycles, double index, double cyclesPerSample)
+    {
+        const double cycles = originCycles + index * cyclesPerSample;
+        return static_cast<float>(cycles - static_cast<double>(static_cast<int>(cycles)));
+    }
+
+    void lfoCurveScalar(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                        float* phases, float* out, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            phases[i] = lfoPhaseSample(originCycles, firstIndex + static_cast<double>(i), cyclesPerSample);
+            out[i] = lfoSineSample(phases[i], offsetCycles);
+        }
+    }
+
+#if SATURATOR_KERNELS_X86
+    void mixAndClampSSE2(const float* dry, const float* wet, const float* mix, float* out, int numSamples)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+        const __m128 infinity = _mm_set1_ps(INFINITY);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m128 m = _mm_loadu_ps(mix + i);
+            const __m128 output = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(dry + i), _mm_sub_ps(one, m)),
+                                             _mm_mul_ps(_mm_loadu_ps(wet + i), m));
+
+            // |x| < inf is false for both infinities and NaN
+            const __m128 finite = _mm_cmplt_ps(_mm_and_ps(output, absMask), infinity);
+            const __m128 clamped = _mm_min_ps(one, _mm_max_ps(minusOne, output));
+            _mm_storeu_ps(out + i, _mm_and_ps(finite, clamped));
+        }
+
+        mixAndClampScalar(dry + i, wet + i, mix + i, out + i, numSamples - i);
+    }
+
+    inline __m128 lfoPhaseSSE2(__m128d origin, __m128d index, __m128d increment)
+    {
+        const __m128d cycles = _mm_add_pd(origin, _mm_mul_pd(index, increment));
+        return _mm_cvtpd_ps(_mm_sub_pd(cycles, _mm_cvtepi32_pd(_mm_cvttpd_epi32(cycles))));
+    }
+
+    inline __m128 lfoSineSSE2(__m128 phase, __m128 offset)
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 minusHalf = _mm_set1_ps(-0.5f);
+
+        __m128 x = _mm_add_ps(phase, offset);
+        x = _mm_sub_ps(x, _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(x, half))));
+
+        __m128 y = _mm_min_ps(x, _mm_sub_ps(half, x));
+        y = _mm_max_ps(y, _mm_sub_ps(minusHalf, y));
+
+        const __m128 z = _mm_mul_ps(y, y);
+        __m128 p = _mm_set1_ps(sinC11);
+        p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(sinC9));
+        p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(sinC7));
+        p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(sinC5));
+        p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(sinC3));
+        p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(sinC1));
+        return _mm_mul_ps(y, p);
+    }
+
+    void lfoCurveSSE2(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                      float* phases, float* out, int numSamples)
+    {
+        const __m128d origin = _mm_set1_pd(originCycles);
+        const __m128d increment = _mm_set1_pd(cyclesPerSample);
+        const __m128d two = _mm_set1_pd(2.0);
+        const __m128 offset = _mm_set1_ps(offsetCycles);
+
+        // Sample indices stay exact integers in double, so every lane matches the scalar phase
+        __m128d index = _mm_set_pd(firstIndex + 1.0, firstIndex);
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m128 low = lfoPhaseSSE2(origin, index, increment);
+            index = _mm_add_pd(index, two);
+            const __m128 high = lfoPhaseSSE2(origin, index, increment);
+            index = _mm_add_pd(index, two);
+
+            const __m128 phase = _mm_movelh_ps(low, high);
+            _mm_storeu_ps(phases + i, phase);
+            _mm_storeu_ps(out + i, lfoSineSSE2(phase, offset));
+        }
+
+        lfoCurveScalar(originCycles, firstIndex + i, cyclesPerSample, offsetCycles, phases + i, out + i, numSamples - i);
+    }
+
+    SATURATOR_TARGET_AVX2
+    void mixAndClampAVX2(const float* dry, const float* wet, const float* mix, float* out, int numSamples)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 minusOne = _mm256_set1_ps(-1.0f);
+        const __m256 infinity = _mm256_set1_ps(INFINITY);
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m256 m = _mm256_loadu_ps(mix + i);
+            const __m256 output = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(dry + i), _mm256_sub_ps(one, m)),
+                                                _mm256_mul_ps(_mm256_loadu_ps(wet + i), m));
+
+            const __m256 finite = _mm256_cmp_ps(_mm256_and_ps(output, absMask), infinity, _CMP_LT_OQ);
+            const __m256 clamped = _mm256_min_ps(one, _mm256_max_ps(minusOne, output));
+            _mm256_storeu_ps(out + i, _mm256_and_ps(finite, clamped));
+        }
+
+        // Clear the upper register halves before any non-VEX code runs: the SSE2 tail and the
+        // scalar chorus recursion would otherwise pay the AVX-SSE transition penalty on every op
+        _mm256_zeroupper();
+        mixAndClampSSE2(dry + i, wet + i, mix + i, out + i, numSamples - i);
+    }
+
+    SATURATOR_TARGET_AVX2
+    inline __m128 lfoPhaseAVX2(__m256d origin, __m256d index, __m256d increment)
+    {
+        const __m256d cycles = _mm256_add_pd(origin, _mm256_mul_pd(index, increment));
+        return _mm256_cvtpd_ps(_mm256_sub_pd(cycles, _mm256_cvtepi32_pd(_mm256_cvttpd_epi32(cycles))));
+    }
+
+    SATURATOR_TARGET_AVX2
+    inline __m256 lfoSineAVX2(__m256 phase, __m256 offset)
+    {
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 minusHalf = _mm256_set1_ps(-0.5f);
+
+        __m256 x = _mm256_add_ps(phase, offset);
+        x = _mm256_sub_ps(x, _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_add_ps(x, half))));
+
+        __m256 y = _mm256_min_ps(x, _mm256_sub_ps(half, x));
+        y = _mm256_max_ps(y, _mm256_sub_ps(minusHalf, y));
+
+        const __m256 z = _mm256_mul_ps(y, y);
+        __m256 p = _mm256_set1_ps(sinC11);
+        p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(sinC9));
+        p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(sinC7));
+        p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(sinC5));
+        p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(sinC3));
+        p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(sinC1));
+        return _mm256_mul_ps(y, p);
+    }
+
+    SATURATOR_TARGET_AVX2
+    void lfoCurveAVX2(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                      float* phases, float* out, int numSamples)
+    {
+        const __m256d origin = _mm256_set1_pd(originCycles);
+        const __m256d increment = _mm256_set1_pd(cyclesPerSample);
+        const __m256d four = _mm256_set1_pd(4.0);
+        const __m256 offset = _mm256_set1_ps(offsetCycles);
+
+        __m256d index = _mm256_set_pd(firstIndex + 3.0, firstIndex + 2.0, firstIndex + 1.0, firstIndex);
+
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m128 low = lfoPhaseAVX2(origin, index, increment);
+            index = _mm256_add_pd(index, four);
+            const __m128 high = lfoPhaseAVX2(origin, index, increment);
+            index = _mm256_add_pd(index, four);
+
+            const __m256 phase = _mm256_set_m128(high, low);
+            _mm256_storeu_ps(phases + i, phase);
+            _mm256_storeu_ps(out + i, lfoSineAVX2(phase, offset));
+        }
+
+        // See mixAndClampAVX2
+        _mm256_zeroupper();
+        lfoCurveSSE2(originCycles, firstIndex + i, cyclesPerSample, offsetCycles, phases + i, out + i, numSamples - i);
+    }
+
+    SATURATOR_TARGET_AVX512
+    void mixAndClampAVX512(const float* dry, const float* wet, const float* mix, float* out, int numSamples)
+    {
+        const __m512 one = _mm512_set1_ps(1.0f);
+        const __m512 minusOne = _mm512_set1_ps(-1.0f);
+        const __m512 infinity = _mm512_set1_ps(INFINITY);
+
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+        {
+            const __m512 m = _mm512_loadu_ps(mix + i);
+            const __m512 output = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(dry + i), _mm512_sub_ps(one, m)),
+                                                _mm512_mul_ps(_mm512_loadu_ps(wet + i), m));
+
+            // Zero-masked min / max clamp and zero the non-finite lanes in one go (the unmasked
+            // forms pass an undefined source through GCC's headers and trip -Wmaybe-uninitialized)
+            const __mmask16 finite = _mm512_cmp_ps_mask(_mm512_abs_ps(output), infinity, _CMP_LT_OQ);
+            const __m512 clamped = _mm512_maskz_min_ps(finite, one, _mm512_maskz_max_ps(finite, minusOne, output));
+            _mm512_storeu_ps(out + i, clamped);
+        }
+
+        // See mixAndClampAVX2: no dirty upper state may leak into the SSE2 tail or the caller
+        _mm256_zeroupper();
+        mixAndClampSSE2(dry + i, wet + i, mix + i, out + i, numSamples - i);
+    }
+
+    // The AVX-512 LFO helpers use zero-masked conversions, min / max and insert with a full
+    // mask for the same -Wmaybe-uninitialized reason as mixAndClampAVX512
+    SATURATOR_TARGET_AVX512
+    inline __m256 lfoPhaseAVX512(__m512d origin, __m512d index, __m512d increment)
+    {
+        const __m512d cycles = _mm512_add_pd(origin, _mm512_mul_pd(index, increment));
+        const __m512d whole = _mm512_maskz_cvtepi32_pd(0xff, _mm512_maskz_cvttpd_epi32(0xff, cycles));
+        return _mm512_maskz_cvtpd_ps(0xff, _mm512_sub_pd(cycles, whole));
+    }
+
+    SATURATOR_TARGET_AVX512
+    inline __m512 lfoSineAVX512(__m512 phase, __m512 offset)
+    {
+        const __m512 half = _mm512_set1_ps(0.5f);
+        const __m512 minusHalf = _mm512_set1_ps(-0.5f);
+
+        __m512 x = _mm512_add_ps(phase, offset);
+        x = _mm512_sub_ps(x, _mm512_maskz_cvtepi32_ps(0xffff, _mm512_maskz_cvttps_epi32(0xffff, _mm512_add_ps(x, half))));
+
+        __m512 y = _mm512_maskz_min_ps(0xffff, x, _mm512_sub_ps(half, x));
+        y = _mm512_maskz_max_ps(0xffff, y, _mm512_sub_ps(minusHalf, y));
+
+        const __m512 z = _mm512_mul_ps(y, y);
+        __m512 p = _mm512_set1_ps(sinC11);
+        p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(sinC9));
+        p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(sinC7));
+        p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(sinC5));
+        p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(sinC3));
+        p = _mm512_add_ps(_mm512_mul_ps(p, z), _mm512_set1_ps(sinC1));
+        return _mm512_mul_ps(y, p);
+    }
+
+    SATURATOR_TARGET_AVX512
+    void lfoCurveAVX512(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                        float* phases, float* out, int numSamples)
+    {
+        const __m512d origin = _mm512_set1_pd(originCycles);
+        const __m512d increment = _mm512_set1_pd(cyclesPerSample);
+        const __m512d eight = _mm512_set1_pd(8.0);
+        const __m512 offset = _mm512_set1_ps(offsetCycles);
+
+        __m512d index = _mm512_set_pd(firstIndex + 7.0, firstIndex + 6.0, firstIndex + 5.0, firstIndex + 4.0,
+                                      firstIndex + 3.0, firstIndex + 2.0, firstIndex + 1.0, firstIndex);
+
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16)
+        {
+            const __m256 low = lfoPhaseAVX512(origin, index, increment);
+            index = _mm512_add_pd(index, eight);
+            const __m256 high = lfoPhaseAVX512(origin, index, increment);
+            index = _mm512_add_pd(index, eight);
+
+            const __m512 phase = _mm512_castpd_ps(_mm512_maskz_insertf64x4(0xff, _mm512_castpd256_pd512(_mm256_castps_pd(low)),
+                                                                           _mm256_castps_pd(high), 1));
+            _mm512_storeu_ps(phases + i, phase);
+            _mm512_storeu_ps(out + i, lfoSineAVX512(phase, offset));
+        }
+
+        // See mixAndClampAVX2
+        _mm256_zeroupper();
+        lfoCurveSSE2(originCycles, firstIndex + i, cyclesPerSample, offsetCycles, phases + i, out + i, numSamples - i);
+    }
+
+    bool cpuSupportsAVX2()
+    {
+       #if defined(_MSC_VER) && ! defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5)) != 0;
+       #else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+       #endif
+    }
+
+    bool cpuSupportsAVX512()
+    {
+       #if defined(_MSC_VER) && ! defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        const bool osSavesZmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0xe6) == 0xe6;
+        __cpuidex(info, 7, 0);
+        return osSavesZmm && (info[1] & (1 << 16)) != 0;
+       #else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+       #endif
+    }
+#endif
+
+#if SATURATOR_KERNELS_NEON
+    void mixAndClampNEON(const float* dry, const float* wet, const float* mix, float* out, int numSamples)
+    {
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+        const float32x4_t infinity = vdupq_n_f32(INFINITY);
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const float32x4_t m = vld1q_f32(mix + i);
+            const float32x4_t output = vaddq_f32(vmulq_f32(vld1q_f32(dry + i), vsubq_f32(one, m)),
+                                                 vmulq_f32(vld1q_f32(wet + i), m));
+
+            const uint32x4_t finite = vcltq_f32(vabsq_f32(output), infinity);
+            const float32x4_t clamped = vminq_f32(one, vmaxq_f32(minusOne, output));
+            vst1q_f32(out + i, vbslq_f32(finite, clamped, zero));
+        }
+
+        mixAndClampScalar(dry + i, wet + i, mix + i, out + i, numSamples - i);
+    }
+
+    inline float32x2_t lfoPhaseNEON(float64x2_t origin, float64x2_t index, float64x2_t increment)
+    {
+        const float64x2_t cycles = vaddq_f64(origin, vmulq_f64(index, increment));
+        return vcvt_f32_f64(vsubq_f64(cycles, vcvtq_f64_s64(vcvtq_s64_f64(cycles))));
+    }
+
+    inline float32x4_t lfoSineNEON(float32x4_t phase, float32x4_t offset)
+    {
+        const float32x4_t half = vdupq_n_f32(0.5f);
+        const float32x4_t minusHalf = vdupq_n_f32(-0.5f);
+
+        float32x4_t x = vaddq_f32(phase, offset);
+        x = vsubq_f32(x, vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(x, half))));
+
+        float32x4_t y = vminq_f32(x, vsubq_f32(half, x));
+        y = vmaxq_f32(y, vsubq_f32(minusHalf, y));
+
+        // Separate multiply and add (not vmlaq / vfmaq) to match the scalar rounding
+        const float32x4_t z = vmulq_f32(y, y);
+        float32x4_t p = vdupq_n_f32(sinC11);
+        p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(sinC9));
+        p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(sinC7));
+        p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(sinC5));
+        p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(sinC3));
+        p = vaddq_f32(vmulq_f32(p, z), vdupq_n_f32(sinC1));
+        return vmulq_f32(y, p);
+    }
+
+    void lfoCurveNEON(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                      float* phases, float* out, int numSamples)
+    {
+        const float64x2_t origin = vdupq_n_f64(originCycles);
+        const float64x2_t increment = vdupq_n_f64(cyclesPerSample);
+        const float64x2_t two = vdupq_n_f64(2.0);
+        const float32x4_t offset = vdupq_n_f32(offsetCycles);
+
+        const double firstIndices[2] = { firstIndex, firstIndex + 1.0 };
+        float64x2_t index = vld1q_f64(firstIndices);
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const float32x2_t low = lfoPhaseNEON(origin, index, increment);
+            index = vaddq_f64(index, two);
+            const float32x2_t high = lfoPhaseNEON(origin, index, increment);
+            index = vaddq_f64(index, two);
+
+            const float32x4_t phase = vcombine_f32(low, high);
+            vst1q_f32(phases + i, phase);
+            vst1q_f32(out + i, lfoSineNEON(phase, offset));
+        }
+
+        lfoCurveScalar(originCycles, firstIndex + i, cyclesPerSample, offsetCycles, phases + i, out + i, numSamples - i);
+    }
+#endif
+}
+
+float lfoSine(float phase, float offsetCycles)
+{
+    return lfoSineSample(phase, offsetCycles);
+}
+
+const char* getIsaName(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Auto:   return "Auto";
+        case Isa::Scalar: return "Scalar";
+        case Isa::SSE2:   return "SSE2";
+        case Isa::AVX2:   return "AVX2";
+        case Isa::AVX512: return "AVX-512";
+        case Isa::NEON:   return "NEON";
+    }
+
+    return "Unknown";
+}
+
+bool isIsaSupported(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Scalar: return true;
+       #if SATURATOR_KERNELS_X86
+        case Isa::SSE2:   return true; // Part of the x86-64 baseline
+        case Isa::AVX2:   return cpuSupportsAVX2();
+        case Isa::AVX512: return cpuSupportsAVX512();
+       #endif
+       #if SATURATOR_KERNELS_NEON
+        case Isa::NEON:   return true; // Part of the AArch64 baseline
+       #endif
+        default:          return false;
+    }
+}
+
+Isa detectBestIsa()
+{
+    static const Isa best = []
+    {
+        for (auto isa : { Isa::AVX512, Isa::AVX2, Isa::SSE2, Isa::NEON })
+            if (isIsaSupported(isa))
+                return isa;
+
+        return Isa::Scalar;
+    }();
+
+    return best;
+}
+
+Isa resolveIsa(Isa requested)
+{
+    if (requested != Isa::Auto && isIsaSupported(requested))
+        return requested;
+
+    return detectBestIsa();
+}
+
+MixAndClampFn getMixAndClamp(Isa isa)
+{
+    switch (resolveIsa(isa))
+    {
+       #if SATURATOR_KERNELS_X86
+        case Isa::SSE2:   return mixAndClampSSE2;
+        case Isa::AVX2:   return mixAndClampAVX2;
+        case Isa::AVX512: return mixAndClampAVX512;
+       #endif
+       #if SATURATOR_KERNELS_NEON
+        case Isa::NEON:   return mixAndClampNEON;
+       #endif
+        default:          return mixAndClampScalar;
+    }
+}
+
+LfoCurveFn getLfoCurve(Isa isa)
+{
+    switch (resolveIsa(isa))
+    {
+       #if SATURATOR_KERNELS_X86
+        case Isa::SSE2:   return lfoCurveSSE2;
+        case Isa::AVX2:   return lfoCurveAVX2;
+        case Isa::AVX512: return lfoCurveAVX512;
+       #endif
+       #if SATURATOR_KERNELS_NEON
+        case Isa::NEON:   return lfoCurveNEON;
+       #endif
+        default:          return lfoCurveScalar;
+    }
+}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+// Vectorisable hot loops of the chorus core, compiled into several ISA variants
+// in the same binary and selected once at prepare() time.
+namespace SaturatorKernels
+{
+    enum class Isa
+    {
+        Auto,   // Best variant supported by the running CPU
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512,
+        NEON
+    };
+
+    // out[i] = dry[i] * (1 - mix[i]) + wet[i] * mix[i], non-finite results become 0,
+    // everything else is clamped to [-1, 1]. out may alias dry or wet.
+    using MixAndClampFn = void (*)(const float* dry, const float* wet, const float* mix,
+                                   float* out, int numSamples);
+
+    // The chorus LFO curve for a run of samples:
+    //   phases[i] = frac(originCycles + (firstIndex + i) * cyclesPerSample)
+    //   out[i]    = sin(2 * pi * (phases[i] + offsetCycles))
+    // firstIndex is an integer sample index and the cycles must be non-negative and below
+    // 2^31. Every variant evaluates the same double-precision phase and sine polynomial, so
+    // they are bit-identical to each other and to lfoSine().
+    using LfoCurveFn = void (*)(double originCycles, double firstIndex, double cyclesPerSample, float offsetCycles,
+                                float* phases, float* out, int numSamples);
+
+    // Single-sample LFO evaluation for control-rate and seeding code outside the per-slice pass
+    float lfoSine(float phase, float offsetCycles);
+
+    const char* getIsaName(Isa isa);
+
+    // Whether the variant is compiled into this binary and supported by the running CPU
+    bool isIsaSupported(Isa isa);
+
+    // One-time CPUID (or architecture) based detection of the fastest supported variant
+    Isa detectBestIsa();
+
+    // Resolves Auto and unsupported requests to a variant that can run here
+    Isa resolveIsa(Isa requested);
+
+    MixAndClampFn getMixAndClamp(Isa isa);
+    LfoCurveFn getLfoCurve(Isa isa);
+}
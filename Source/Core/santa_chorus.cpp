@@ -0,0 +1,120 @@
+#include "santa_chorus.h"
+#include "ChorusCore.h"
+#include <new>
+
+struct SantaChorus
+{
+    ChorusCore core;
+};
+
+SantaChorus* santa_chorus_create(void)
+{
+    return new (std::nothrow) SantaChorus();
+}
+
+void santa_chorus_destroy(SantaChorus* chorus)
+{
+    delete chorus;
+}
+
+int santa_chorus_prepare(SantaChorus* chorus, double sample_rate, int max_block_size, int num_channels)
+{
+    if (chorus == nullptr || sample_rate <= 0.0 || max_block_size <= 0 || num_channels <= 0)
+        return -1;
+
+    // Exceptions must not cross the C boundary
+    try
+    {
+        chorus->core.prepare(sample_rate, max_block_size, num_channels);
+        return 0;
+    }
+    catch (...)
+    {
+        return -1;
+    }
+}
+
+void santa_chorus_set_chorus(SantaChorus* chorus, float amount)
+{
+    if (chorus == nullptr)
+        return;
+
+    chorus->core.setChorus(amount);
+}
+
+void santa_chorus_set_mix(SantaChorus* chorus, float mix)
+{
+    if (chorus == nullptr)
+        return;
+
+    chorus->core.setMix(mix);
+}
+
+void santa_chorus_process(SantaChorus* chorus, float* const* channels, int num_channels, int num_samples)
+{
+    if (chorus == nullptr || channels == nullptr)
+        return;
+
+    chorus->core.process(AudioBufferView(channels, num_channels, num_samples));
+}
+
+void santa_chorus_process_interleaved(SantaChorus* chorus, float* interleaved, int num_channels, int num_frames)
+{
+    if (chorus == nullptr || interleaved == nullptr)
+        return;
+
+    chorus->core.process(AudioBufferView::fromInterleaved(interleaved, num_channels, num_frames));
+}
+
+void santa_chorus_process_bypassed(SantaChorus* chorus, float* const* channels, int num_channels, int num_samples)
+{
+    if (chorus == nullptr || channels == nullptr)
+        return;
+
+    chorus->core.processBypassed(AudioBufferView(channels, num_channels, num_samples));
+}
+
+void santa_chorus_set_position_deterministic(SantaChorus* chorus, int enabled)
+{
+    if (chorus == nullptr)
+        return;
+
+    chorus->core.setPositionDeterministic(enabled != 0);
+}
+
+void santa_chorus_seek(SantaChorus* chorus, int64_t sample_position)
+{
+    if (chorus == nullptr)
+        return;
+
+    chorus->core.seek(sample_position);
+}
+
+int santa_chorus_get_warmup_length(const SantaChorus* chorus)
+{
+    return chorus != nullptr ? chorus->core.getWarmupLengthSamples() : 0;
+}
+
+void santa_chorus_set_governor_threshold(SantaChorus* chorus, float fraction_of_budget)
+{
+    if (chorus == nullptr)
+        return;
+
+    chorus->core.setGovernorThreshold(fraction_of_budget);
+}
+
+int santa_chorus_get_processing_tier(const SantaChorus* chorus)
+{
+    return chorus != nullptr ? static_cast<int>(chorus->core.getProcessingTier()) : 0;
+}
+
+float santa_chorus_get_cpu_load(const SantaChorus* chorus)
+{
+    return chorus != nullptr ? chorus->core.getCpuLoad() : 0.0f;
+}
+
+const char* santa_chorus_get_kernel_name(const SantaChorus* chorus)
+{
+    // Auto until prepare() has resolved a variant for this CPU
+    return SaturatorKernels::getIsaName(chorus != nullptr ? chorus->core.getActiveKernel() : SaturatorKernels::Isa::Auto);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/* C API for the JUCE-free Santa Chorus DSP core.
+   Audio is processed in place in caller-owned memory. A handle must only be
+   used from one thread at a time, except for the parameter setters.
+   Every function accepts a NULL handle: setters and processing calls do
+   nothing, getters return 0 (or "Auto" for the kernel name). */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SantaChorus SantaChorus;
+
+/* Returns NULL if the instance could not be allocated */
+SantaChorus* santa_chorus_create(void);
+void santa_chorus_destroy(SantaChorus* chorus);
+
+/* Allocates delay lines and scratch; returns 0 on success, -1 on failure */
+int santa_chorus_prepare(SantaChorus* chorus, double sample_rate, int max_block_size, int num_channels);
+
+/* Parameters in [0, 1], smoothed internally */
+void santa_chorus_set_chorus(SantaChorus* chorus, float amount);
+void santa_chorus_set_mix(SantaChorus* chorus, float mix);
+
+/* channels: one pointer per channel; interleaved: num_frames * num_channels samples */
+void santa_chorus_process(SantaChorus* chorus, float* const* channels, int num_channels, int num_samples);
+void santa_chorus_process_interleaved(SantaChorus* chorus, float* interleaved, int num_channels, int num_frames);
+
+/* Leaves audio untouched but keeps the delay lines and LFO running */
+void santa_chorus_process_bypassed(SantaChorus* chorus, float* const* channels, int num_channels, int num_samples);
+
+/* Position-deterministic mode for chunked offline rendering (see ChorusCore) */
+void santa_chorus_set_position_deterministic(SantaChorus* chorus, int enabled);
+void santa_chorus_seek(SantaChorus* chorus, int64_t sample_position);
+int santa_chorus_get_warmup_length(const SantaChorus* chorus);
+
+/* CPU governor: threshold as a fraction of the real-time budget, 0 disables it */
+void santa_chorus_set_governor_threshold(SantaChorus* chorus, float fraction_of_budget);
+int santa_chorus_get_processing_tier(const SantaChorus* chorus);
+float santa_chorus_get_cpu_load(const SantaChorus* chorus);
+
+/* Name of the SIMD kernel variant chosen by the last prepare(), "Auto" before the first one */
+const char* santa_chorus_get_kernel_name(const SantaChorus* chorus);
+
+#ifdef __cplusplus
+}
+#endif
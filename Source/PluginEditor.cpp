@@ -123,6 +123,12 @@ SaturVSTEditor::SaturVSTEditor (SaturVSTProcessor& p)
     versionLabel.setColour(juce::Label::textColourId, juce::Colour(0x80FFFFFF)); // Semi-transparent white
     addAndMakeVisible(versionLabel);
 
+    // Setup CPU governor tier label (bottom left corner)
+    tierLabel.setFont(juce::Font(juce::FontOptions().withHeight(10.0f)));
+    tierLabel.setJustificationType(juce::Justification::centredLeft);
+    tierLabel.setColour(juce::Label::textColourId, juce::Colour(0x80FFFFFF)); // Semi-transparent white
+    addAndMakeVisible(tierLabel);
+
     // Create parameter attachments
     chorusAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.getValueTreeState(), "chorus", chorusSlider);
@@ -132,10 +138,14 @@ SaturVSTEditor::SaturVSTEditor (SaturVSTProcessor& p)
 
     // Устанавливаем размер окна точно под размер background изображения (769 × 398)
     setSize(762, 430);
+
+    startTimerHz(4);
 }
 
 SaturVSTEditor::~SaturVSTEditor()
 {
+    stopTimer();
+
     chorusSlider.setLookAndFeel(nullptr);
     mixSlider.setLookAndFeel(nullptr);
 }
@@ -175,4 +185,21 @@ void SaturVSTEditor::resized()
     
     // Position version label in bottom right corner
     versionLabel.setBounds(getWidth() - 80, getHeight() - 20, 75, 15);
+    
+    // Position tier label in bottom left corner
+    tierLabel.setBounds(5, getHeight() - 20, 120, 15);
+}
+
+void SaturVSTEditor::timerCallback()
+{
+    juce::String tierText;
+
+    switch (audioProcessor.getProcessingTier())
+    {
+        case SaturatorEngine::ProcessingTier::Full:        break;
+        case SaturatorEngine::ProcessingTier::ControlRate: tierText = "CPU SAVER 1"; break;
+        case SaturatorEngine::ProcessingTier::Minimal:     tierText = "CPU SAVER 2"; break;
+    }
+
+    tierLabel.setText(tierText, juce::dontSendNotification);
 } 
\ No newline at end of file
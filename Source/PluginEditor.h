@@ -18,7 +18,8 @@ private:
     juce::Colour ringColour;
 };
 
-class SaturVSTEditor : public juce::AudioProcessorEditor
+class SaturVSTEditor : public juce::AudioProcessorEditor,
+                       private juce::Timer
 {
 public:
     SaturVSTEditor (SaturVSTProcessor&);
@@ -30,6 +31,9 @@ public:
 private:
     SaturVSTProcessor& audioProcessor;
 
+    // Polls the engine's CPU governor tier
+    void timerCallback() override;
+
     // Helper function for drawing signal flow arrows
     void drawArrow(juce::Graphics& g, int x1, int y, int x2, int yEnd);
 
@@ -54,5 +58,8 @@ private:
     // Version label
     juce::Label versionLabel;
 
+    // CPU governor tier label (empty at full quality)
+    juce::Label tierLabel;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SaturVSTEditor)
 }; 
\ No newline at end of file
@@ -100,6 +100,8 @@ void SaturVSTProcessor::changeProgramName (int index, const juce::String& newNam
 
 void SaturVSTProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    // Offline bounces have no real-time budget: keep them at full quality however long a block takes
+    saturatorEngine.setGovernorThreshold(isNonRealtime() ? 0.0f : ChorusCore::defaultGovernorThreshold);
     saturatorEngine.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
 }
 
@@ -169,6 +171,25 @@ void SaturVSTProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::Mi
     }
 }
 
+void SaturVSTProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ScopedNoDenormals noDenormals;
+    auto totalNumInputChannels  = getTotalNumInputChannels();
+    auto totalNumOutputChannels = getTotalNumOutputChannels();
+
+    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+        buffer.clear (i, 0, buffer.getNumSamples());
+
+    // Input passes through untouched; the engine only keeps its delay lines and LFO warm
+    if (chorusParameter && mixParameter)
+    {
+        saturatorEngine.setChorus(chorusParameter->load());
+        saturatorEngine.setMix(mixParameter->load());
+    }
+
+    saturatorEngine.processBypassed(buffer);
+}
+
 bool SaturVSTProcessor::hasEditor() const
 {
     return true;
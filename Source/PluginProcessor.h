@@ -18,6 +18,7 @@ public:
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -41,6 +42,13 @@ public:
     // Parameter management
     juce::AudioProcessorValueTreeState& getValueTreeState() { return valueTreeState; }
 
+    // CPU governor state for the editor and profiling
+    SaturatorEngine::ProcessingTier getProcessingTier() const { return saturatorEngine.getProcessingTier(); }
+    float getCpuLoad() const { return saturatorEngine.getCpuLoad(); }
+
+    // SIMD kernel variant picked at prepareToPlay (reported by the load simulator)
+    SaturatorKernels::Isa getActiveKernel() const { return saturatorEngine.getActiveKernel(); }
+
 private:
     SaturatorEngine saturatorEngine;
     juce::AudioProcessorValueTreeState valueTreeState;
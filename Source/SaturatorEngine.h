@@ -1,77 +1,44 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
-#include <juce_dsp/juce_dsp.h>
+#include "ChorusCore.h"
 
+// Plugin-side adapter: feeds juce::AudioBuffer into the JUCE-free ChorusCore
 class SaturatorEngine
 {
 public:
+    using ProcessingTier = ChorusCore::ProcessingTier;
+
     SaturatorEngine();
     ~SaturatorEngine();
 
     void prepare(double sampleRate, int samplesPerBlock, int numChannels);
     void processBlock(juce::AudioBuffer<float>& buffer);
 
-    // Parameter setters: Chorus and Dry/Wet mix
-    void setChorus(float newChorus);
-    void setMix(float newMix);
+    // Warm bypass: leaves the buffer untouched but keeps delay lines, filters and the LFO
+    // running so that un-bypassing is click-free
+    void processBypassed(juce::AudioBuffer<float>& buffer);
 
-private:
+    // Parameter setters: Chorus and Dry/Wet mix
+    void setChorus(float newChorus) { core.setChorus(newChorus); }
+    void setMix(float newMix) { core.setMix(newMix); }
 
-    // High-quality chorus processing (based on professional implementations)
-    struct ChorusChannel
-    {
-        // Delay line buffer (larger for better quality)
-        std::vector<float> delayBuffer;
-        int writeIndex = 0;
-        
-        // Linear interpolation state (more stable than all-pass for modulated delays)
-        float prevSample = 0.0f;
-        
-        // Smoothed delay parameter to avoid artifacts
-        juce::SmoothedValue<float> smoothedDelay;
-        
-        // DC blocker for clean sound
-        float dcBlocker_x1 = 0.0f;
-        float dcBlocker_y1 = 0.0f;
-        
-        // Low-pass filter for anti-aliasing
-        float lpf_state = 0.0f;
-    };
-    
-    // Per-channel chorus processing
-    std::vector<ChorusChannel> chorusChannels;
-    
-    // Stereo LFOs with phase offset for width
-    juce::dsp::Oscillator<float> lfoLeft;   // Left channel LFO
-    juce::dsp::Oscillator<float> lfoRight;  // Right channel LFO (90° phase offset)
-    
-    // High-quality interpolation
-    float linearInterpolation(float delayInSamples, int channel, float inputSample);
-    
-    // Professional chorus processing
-    float processHighQualityChorus(float inputSample, int channel, float chorusAmount);
-    
-    // DC blocking filter
-    float dcBlocker(float inputSample, int channel);
+    // Position-deterministic mode for chunked offline rendering (see ChorusCore)
+    void setPositionDeterministic(bool shouldBeDeterministic) { core.setPositionDeterministic(shouldBeDeterministic); }
+    bool isPositionDeterministic() const { return core.isPositionDeterministic(); }
+    void seek(juce::int64 newSamplePosition) { core.seek(newSamplePosition); }
+    juce::int64 getSamplePosition() const { return core.getSamplePosition(); }
+    int getWarmupLengthSamples() const { return core.getWarmupLengthSamples(); }
 
-    // Parameters
-    std::atomic<float> chorus{ 0.5f };
-    std::atomic<float> mix{ 0.5f };
+    // Kernel variant override (for testing) and the variant picked at prepare()
+    void setKernelOverride(SaturatorKernels::Isa isa) { core.setKernelOverride(isa); }
+    SaturatorKernels::Isa getActiveKernel() const { return core.getActiveKernel(); }
 
-    // Processing variables
-    double currentSampleRate = 44100.0;
-    int currentSamplesPerBlock = 512;
-    int currentNumChannels = 2;
+    // Adaptive CPU governor
+    void setGovernorThreshold(float fractionOfBudget) { core.setGovernorThreshold(fractionOfBudget); }
+    ProcessingTier getProcessingTier() const { return core.getProcessingTier(); }
+    float getCpuLoad() const { return core.getCpuLoad(); }
 
-    // Smoothed parameters to avoid zipper noise
-    juce::SmoothedValue<float> smoothedChorus;
-    juce::SmoothedValue<float> smoothedMix;
-    
-    // Professional chorus parameters (based on high-quality implementations)
-    static constexpr int maxDelayInSamples = 1764;  // 40ms at 44.1kHz
-    static constexpr float minDelayMs = 2.5f;       // Minimum delay: 2.5ms (prevents flanging)
-    static constexpr float maxDelayMs = 15.0f;      // Maximum delay: 15ms (classic chorus range)
-    static constexpr float lfoRateHz = 0.5f;        // 0.5 Hz (classic chorus rate)
-    static constexpr float lfoDepthScale = 0.8f;    // Maximum LFO depth scaling
-}; 
\ No newline at end of file
+private:
+    ChorusCore core;
+};
@@ -0,0 +1,375 @@
+// Core-only approximation of the load simulator (LoadSimulator.cpp) for machines without a
+// JUCE checkout: drives hundreds of bare ChorusCore instances with the same callback pattern,
+// automation and mid-run parameter reload, and prints the same report.
+//
+// It does not measure the plugin itself: there is no SaturVSTProcessor, no parameter
+// listeners or AudioProcessorValueTreeState, and the "state reload" only restores two atomic
+// parameter values instead of going through setStateInformation. Each instance mirrors the
+// engine part of SaturVSTProcessor::processBlock (denormals flushed, atomic parameter values
+// pushed into the engine, in-place processing of the host's planar buffer).
+
+#include "ChorusCore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+ #include <xmmintrin.h>
+#endif
+
+#if defined(__linux__)
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#elif defined(__APPLE__)
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+    struct Options
+    {
+        int numInstances = 200;
+        int blockSize = 256;
+        double sampleRate = 48000.0;
+        double seconds = 10.0;
+        bool realtime = true;     // Pace callbacks like a real audio device
+        std::uint32_t seed = 1;
+    };
+
+    Options parseOptions(int argc, char* argv[])
+    {
+        Options options;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const char* next = i + 1 < argc ? argv[i + 1] : "0";
+
+            if (arg == "--instances")      { options.numInstances = std::max(1, std::atoi(next)); ++i; }
+            else if (arg == "--block")     { options.blockSize = std::max(16, std::atoi(next)); ++i; }
+            else if (arg == "--rate")      { options.sampleRate = std::max(8000.0, std::atof(next)); ++i; }
+            else if (arg == "--seconds")   { options.seconds = std::max(0.1, std::atof(next)); ++i; }
+            else if (arg == "--seed")      { options.seed = static_cast<std::uint32_t>(std::strtoul(next, nullptr, 10)); ++i; }
+            else if (arg == "--fast")      { options.realtime = false; }
+        }
+
+        return options;
+    }
+
+    // Resident set size of the whole process in bytes (0 when unavailable)
+    std::int64_t getResidentBytes()
+    {
+       #if defined(__linux__)
+        long totalPages = 0, residentPages = 0;
+        if (auto* statm = std::fopen("/proc/self/statm", "r"))
+        {
+            if (std::fscanf(statm, "%ld %ld", &totalPages, &residentPages) != 2)
+                residentPages = 0;
+            std::fclose(statm);
+        }
+        return static_cast<std::int64_t>(residentPages) * sysconf(_SC_PAGESIZE);
+       #elif defined(__APPLE__)
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+            return 0;
+        return static_cast<std::int64_t>(info.resident_size);
+       #else
+        return 0;
+       #endif
+    }
+
+    // Hardware cache counter for the calling thread (perf events, Linux only)
+    class CacheCounter
+    {
+    public:
+        explicit CacheCounter(int config)
+        {
+           #if defined(__linux__)
+            perf_event_attr attr {};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = static_cast<__u64>(config);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+           #else
+            (void) config;
+           #endif
+        }
+
+        ~CacheCounter()
+        {
+           #if defined(__linux__)
+            if (fd >= 0)
+                close(fd);
+           #endif
+        }
+
+        bool isAvailable() const { return fd >= 0; }
+
+        void start()
+        {
+           #if defined(__linux__)
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+           #endif
+        }
+
+        std::uint64_t stop()
+        {
+            std::uint64_t count = 0;
+           #if defined(__linux__)
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                if (read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+                    count = 0;
+            }
+           #endif
+            return count;
+        }
+
+    private:
+        int fd = -1;
+    };
+
+   #if defined(__linux__)
+    constexpr int cacheReferencesEvent = PERF_COUNT_HW_CACHE_REFERENCES;
+    constexpr int cacheMissesEvent = PERF_COUNT_HW_CACHE_MISSES;
+   #else
+    constexpr int cacheReferencesEvent = 0;
+    constexpr int cacheMissesEvent = 0;
+   #endif
+
+    // Flush-to-zero / denormals-are-zero for the audio thread, like juce::ScopedNoDenormals
+    void disableDenormals()
+    {
+       #if defined(__x86_64__) || defined(_M_X64)
+        _mm_setcsr(_mm_getcsr() | 0x8040);
+       #endif
+    }
+
+    double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        if (sorted.empty())
+            return 0.0;
+
+        const auto index = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size()))) - 1;
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    // One plugin instance: the engine, its host buffer and the parameter values the host
+    // automates (the plugin's AudioProcessorValueTreeState atomics)
+    struct Instance
+    {
+        ChorusCore core;
+        std::vector<float> left, right;
+        std::atomic<float> chorusParameter{ 0.5f };
+        std::atomic<float> mixParameter{ 0.5f };
+        float initialChorus = 0.5f;
+        float initialMix = 0.5f;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    const auto options = parseOptions(argc, argv);
+
+    // One second of source material, and at least two blocks so every callback has a valid offset
+    const int sourceLength = std::max(static_cast<int>(options.sampleRate), 2 * options.blockSize);
+    const int numCallbacks = static_cast<int>(std::ceil(options.seconds * options.sampleRate / options.blockSize));
+    const int reloadCallback = numCallbacks / 2;
+    const double budgetSeconds = options.blockSize / options.sampleRate;
+
+    std::printf("Santa Chorus load simulator (core-only approximation): %d instances, %d samples @ %.0f Hz, %.1f s (%s)\n",
+                options.numInstances, options.blockSize, options.sampleRate, options.seconds,
+                options.realtime ? "real-time paced" : "as fast as possible");
+
+    // Instantiate and prepare all instances, measuring the memory they add
+    const auto residentBefore = getResidentBytes();
+
+    std::mt19937 setupRandom(options.seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<std::unique_ptr<Instance>> instances;
+    instances.reserve(static_cast<size_t>(options.numInstances));
+    for (int i = 0; i < options.numInstances; ++i)
+    {
+        auto instance = std::make_unique<Instance>();
+        instance->core.prepare(options.sampleRate, options.blockSize, 2);
+        instance->left.assign(static_cast<size_t>(options.blockSize), 0.0f);
+        instance->right.assign(static_cast<size_t>(options.blockSize), 0.0f);
+        instance->initialChorus = unit(setupRandom);
+        instance->initialMix = unit(setupRandom);
+        instance->chorusParameter.store(instance->initialChorus);
+        instance->mixParameter.store(instance->initialMix);
+        instances.push_back(std::move(instance));
+    }
+
+    const auto residentAfter = getResidentBytes();
+
+    // Source material shared by all instances, copied in like a host filling its buffers
+    std::vector<float> source(static_cast<size_t>(2 * sourceLength));
+    for (int ch = 0; ch < 2; ++ch)
+        for (int i = 0; i < sourceLength; ++i)
+            source[static_cast<size_t>(ch * sourceLength + i)] = 0.3f * std::sin(0.02f * static_cast<float>(i * (ch + 1)))
+                                                                 + 0.1f * (unit(setupRandom) * 2.0f - 1.0f);
+
+    std::vector<double> callbackSeconds(static_cast<size_t>(numCallbacks), 0.0);
+    std::atomic<int> callbacksDone{ 0 };
+    std::atomic<bool> reloadStarted{ false };
+    std::uint64_t cacheReferences = 0, cacheMisses = 0;
+    bool cacheCountersAvailable = false;
+    int tierCounts[3] = { 0, 0, 0 };
+    float meanCpuLoad = 0.0f, maxCpuLoad = 0.0f;
+
+    // Simulated host audio thread
+    std::thread audioThread([&]
+    {
+        disableDenormals();
+        std::mt19937 automationRandom(options.seed + 1);
+        std::uniform_int_distribution<int> quarter(0, 3);
+        std::uniform_real_distribution<float> step(-0.05f, 0.05f);
+
+        CacheCounter references(cacheReferencesEvent), misses(cacheMissesEvent);
+        cacheCountersAvailable = references.isAvailable() && misses.isAvailable();
+        references.start();
+        misses.start();
+
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(budgetSeconds));
+        auto deadline = std::chrono::steady_clock::now();
+
+        for (int callback = 0; callback < numCallbacks; ++callback)
+        {
+            // Without real-time pacing the run can end before the message thread is scheduled,
+            // so the midpoint waits (outside the timed region) until the reload has begun
+            if (callback == reloadCallback && !options.realtime)
+                while (!reloadStarted.load())
+                    std::this_thread::yield();
+
+            const int sourceOffset = (callback * options.blockSize) % (sourceLength - options.blockSize);
+            const auto start = std::chrono::steady_clock::now();
+
+            for (auto& instance : instances)
+            {
+                // Randomized host automation: a slow random walk on roughly a quarter of the callbacks
+                if (quarter(automationRandom) == 0)
+                {
+                    instance->chorusParameter.store(std::clamp(instance->chorusParameter.load() + step(automationRandom), 0.0f, 1.0f));
+                    instance->mixParameter.store(std::clamp(instance->mixParameter.load() + step(automationRandom), 0.0f, 1.0f));
+                }
+
+                std::memcpy(instance->left.data(), source.data() + sourceOffset,
+                            sizeof(float) * static_cast<size_t>(options.blockSize));
+                std::memcpy(instance->right.data(), source.data() + sourceLength + sourceOffset,
+                            sizeof(float) * static_cast<size_t>(options.blockSize));
+
+                // Same per-block work as SaturVSTProcessor::processBlock
+                instance->core.setChorus(instance->chorusParameter.load());
+                instance->core.setMix(instance->mixParameter.load());
+
+                float* channels[] = { instance->left.data(), instance->right.data() };
+                instance->core.process(AudioBufferView(channels, 2, options.blockSize));
+            }
+
+            callbackSeconds[static_cast<size_t>(callback)] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            callbacksDone.store(callback + 1);
+
+            if (options.realtime)
+            {
+                deadline += period;
+                std::this_thread::sleep_until(deadline);
+            }
+        }
+
+        cacheReferences = references.stop();
+        cacheMisses = misses.stop();
+
+        for (auto& instance : instances)
+        {
+            ++tierCounts[static_cast<int>(instance->core.getProcessingTier())];
+            meanCpuLoad += instance->core.getCpuLoad() / static_cast<float>(instances.size());
+            maxCpuLoad = std::max(maxCpuLoad, instance->core.getCpuLoad());
+        }
+    });
+
+    // Mid-run, the "message thread" restores every instance's initial state while audio runs
+    while (callbacksDone.load() < reloadCallback)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    reloadStarted.store(true);
+    const int reloadStartCallback = callbacksDone.load();
+    for (auto& instance : instances)
+    {
+        instance->chorusParameter.store(instance->initialChorus);
+        instance->mixParameter.store(instance->initialMix);
+    }
+    const int reloadDoneCallback = callbacksDone.load();
+
+    audioThread.join();
+
+    // Report
+    auto sorted = callbackSeconds;
+    std::sort(sorted.begin(), sorted.end());
+    const auto overruns = std::count_if(sorted.begin(), sorted.end(), [&](double s) { return s > budgetSeconds; });
+    const auto toMs = [](double seconds) { return seconds * 1000.0; };
+
+    std::printf("\nKernel variant:          %s\n", SaturatorKernels::getIsaName(instances.front()->core.getActiveKernel()));
+    std::printf("Callback budget:         %.3f ms\n", toMs(budgetSeconds));
+    std::printf("Callback time p50:       %.3f ms\n", toMs(percentile(sorted, 0.50)));
+    std::printf("Callback time p99:       %.3f ms\n", toMs(percentile(sorted, 0.99)));
+    std::printf("Callback time p99.9:     %.3f ms\n", toMs(percentile(sorted, 0.999)));
+    std::printf("Callback time max:       %.3f ms\n", toMs(sorted.back()));
+    std::printf("Jitter (p99.9 - p50):    %.3f ms\n", toMs(percentile(sorted, 0.999) - percentile(sorted, 0.50)));
+    std::printf("Overruns:                %d of %d callbacks\n", static_cast<int>(overruns), numCallbacks);
+
+    if (reloadDoneCallback < numCallbacks)
+        std::printf("State reload:            during callbacks %d-%d\n", reloadStartCallback, reloadDoneCallback);
+    else
+        std::printf("State reload:            started at callback %d, finished after the run (missed it)\n", reloadStartCallback);
+
+    std::printf("Governor tiers at end:   full %d, control-rate %d, minimal %d\n", tierCounts[0], tierCounts[1], tierCounts[2]);
+    std::printf("Governor load at end:    mean %.1f%%, max %.1f%% of the block budget\n",
+                100.0 * meanCpuLoad, 100.0 * maxCpuLoad);
+
+    if (cacheCountersAvailable)
+    {
+        const double instanceBlocks = static_cast<double>(numCallbacks) * options.numInstances;
+        std::printf("Cache misses:            %llu of %llu references (%.1f%%), %.1f per instance block\n",
+                    static_cast<unsigned long long>(cacheMisses), static_cast<unsigned long long>(cacheReferences),
+                    cacheReferences > 0 ? 100.0 * static_cast<double>(cacheMisses) / static_cast<double>(cacheReferences) : 0.0,
+                    static_cast<double>(cacheMisses) / instanceBlocks);
+    }
+    else
+    {
+        std::printf("Cache misses:            unavailable (no perf events)\n");
+    }
+
+    if (residentBefore > 0 && residentAfter > 0)
+        std::printf("Memory per instance:     %.1f KiB resident (%d bytes object)\n",
+                    static_cast<double>(residentAfter - residentBefore) / 1024.0 / options.numInstances,
+                    static_cast<int>(sizeof(Instance)));
+    else
+        std::printf("Memory per instance:     unavailable (%d bytes object)\n", static_cast<int>(sizeof(Instance)));
+
+    std::printf("\nCore-only approximation: bare ChorusCore instances, not SaturVSTProcessor (see LoadSimulator.cpp)\n");
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Determinism check: renders material serially and in independent chunks (each with the
+// advertised warm-up pre-roll and a different block size) through the C API, the way a
+// render service would, and fails (exit code 1) unless both renders are bit-identical.
+// Runs without flush-to-zero so decaying filter state is compared at full precision.
+
+#include "santa_chorus.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numChannels = 2;
+    constexpr int length = 48000 * 6;
+    constexpr int chunkLength = 48000 + 777; // Deliberately not a multiple of either block size
+    constexpr int serialBlockSize = 512;
+    constexpr int chunkBlockSize = 300;
+
+    using Material = std::vector<std::vector<float>>;
+
+    SantaChorus* createRenderer(int blockSize)
+    {
+        auto* chorus = santa_chorus_create();
+        if (chorus == nullptr)
+            return nullptr;
+
+        santa_chorus_set_chorus(chorus, 0.8f);
+        santa_chorus_set_mix(chorus, 0.7f);
+        santa_chorus_set_position_deterministic(chorus, 1);
+        santa_chorus_set_governor_threshold(chorus, 0.0f);
+
+        if (santa_chorus_prepare(chorus, sampleRate, blockSize, numChannels) != 0)
+        {
+            santa_chorus_destroy(chorus);
+            return nullptr;
+        }
+
+        return chorus;
+    }
+
+    // Processes [start, end) of the material in place, in blocks of blockSize
+    void render(SantaChorus* chorus, Material& audio, int start, int end, int blockSize)
+    {
+        for (int position = start; position < end; position += blockSize)
+        {
+            const int numSamples = std::min(blockSize, end - position);
+            float* channels[] = { audio[0].data() + position, audio[1].data() + position };
+            santa_chorus_process(chorus, channels, numChannels, numSamples);
+        }
+    }
+
+    Material renderSerial(const Material& input)
+    {
+        auto output = input;
+        auto* chorus = createRenderer(serialBlockSize);
+        render(chorus, output, 0, length, serialBlockSize);
+        santa_chorus_destroy(chorus);
+        return output;
+    }
+
+    Material renderChunked(const Material& input)
+    {
+        auto output = input;
+
+        for (int chunkStart = 0; chunkStart < length; chunkStart += chunkLength)
+        {
+            const int chunkEnd = std::min(length, chunkStart + chunkLength);
+
+            // A fresh instance per chunk, as on another render node
+            auto* chorus = createRenderer(chunkBlockSize);
+            const int warmupStart = std::max(0, chunkStart - santa_chorus_get_warmup_length(chorus));
+            santa_chorus_seek(chorus, warmupStart);
+
+            // Pre-roll on a scratch copy of the input preceding the chunk, then discard it
+            Material preRoll = input;
+            render(chorus, preRoll, warmupStart, chunkStart, chunkBlockSize);
+            render(chorus, output, chunkStart, chunkEnd, chunkBlockSize);
+
+            santa_chorus_destroy(chorus);
+        }
+
+        return output;
+    }
+
+    Material makeMaterial(const std::function<float(int, int)>& sample)
+    {
+        Material audio(numChannels, std::vector<float>(length));
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < length; ++i)
+                audio[static_cast<size_t>(ch)][static_cast<size_t>(i)] = sample(ch, i);
+        return audio;
+    }
+
+    bool check(const char* name, const Material& input)
+    {
+        const auto serial = renderSerial(input);
+        const auto chunked = renderChunked(input);
+
+        int mismatches = 0;
+        float maxDifference = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int i = 0; i < length; ++i)
+            {
+                const float a = serial[static_cast<size_t>(ch)][static_cast<size_t>(i)];
+                const float b = chunked[static_cast<size_t>(ch)][static_cast<size_t>(i)];
+
+                if (std::memcmp(&a, &b, sizeof(float)) != 0)
+                {
+                    ++mismatches;
+                    maxDifference = std::max(maxDifference, std::fabs(a - b));
+                }
+            }
+        }
+
+        std::printf("%-28s %s", name, mismatches == 0 ? "identical\n" : "MISMATCH");
+        if (mismatches > 0)
+            std::printf(" (%d samples, max difference %g)\n", mismatches, static_cast<double>(maxDifference));
+
+        return mismatches == 0;
+    }
+}
+
+int main()
+{
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
+
+    const auto tonesAndNoise = makeMaterial([&](int ch, int i)
+    {
+        return 0.4f * std::sin(0.013f * static_cast<float>(i * (ch + 1))) + noise(random);
+    });
+
+    // DC offset followed by silence: the DC blocker's history decays towards denormals
+    const auto dcThenSilence = makeMaterial([&](int ch, int i)
+    {
+        return i < length / 3 ? 0.5f - 0.2f * static_cast<float>(ch) + 0.05f * std::sin(0.02f * static_cast<float>(i)) : 0.0f;
+    });
+
+    // Bursts separated by silence that starts and ends inside warm-up regions
+    const auto bursts = makeMaterial([&](int, int i)
+    {
+        return (i / 20000) % 2 == 0 ? 0.3f + noise(random) : 0.0f;
+    });
+
+    std::printf("Serial (%d-sample blocks) vs chunked (%d-sample chunks, %d-sample blocks)\n",
+                serialBlockSize, chunkLength, chunkBlockSize);
+
+    bool ok = true;
+    ok = check("Tones and noise", tonesAndNoise) && ok;
+    ok = check("DC offset, then silence", dcThenSilence) && ok;
+    ok = check("DC bursts", bursts) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+// Kernel benchmark: times the vectorised stages (LFO curve, mix / clamp) on their own and
+// ChorusCore as a whole with the Scalar reference and every SIMD variant this CPU supports,
+// recording which variant Auto dispatches to. The end-to-end gain is bounded by the scalar
+// smoother / delay-line recursion between the two stages. Report only: it flags Auto being
+// clearly slower than Scalar, or Scalar slowing down after a vector variant has run (which
+// is what leaked AVX upper-register state looks like), but wall-clock ratios are too noisy
+// on shared machines to gate a build on.
+
+#include "ChorusCore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 256;
+    constexpr int numChannels = 2;
+    constexpr double maxSlowdown = 1.5; // Auto / Scalar ratio flagged as a regression
+
+    // Nanoseconds per sample per channel, best of several passes over the same material
+    double measure(SaturatorKernels::Isa isa, double seconds)
+    {
+        ChorusCore core;
+        core.setKernelOverride(isa);
+        core.setGovernorThreshold(0.0f); // Time the full-quality path only
+        core.setChorus(0.7f);
+        core.setMix(0.6f);
+        core.prepare(sampleRate, blockSize, numChannels);
+
+        const int numBlocks = static_cast<int>(seconds * sampleRate / blockSize);
+        const int length = numBlocks * blockSize;
+
+        // Source material is generated up front so that only the engine is timed
+        std::vector<float> sourceLeft(static_cast<size_t>(length)), sourceRight(static_cast<size_t>(length));
+        for (int i = 0; i < length; ++i)
+        {
+            sourceLeft[static_cast<size_t>(i)] = 0.5f * std::sin(0.031f * static_cast<float>(i));
+            sourceRight[static_cast<size_t>(i)] = 0.5f * std::sin(0.017f * static_cast<float>(i));
+        }
+
+        std::vector<float> left(blockSize), right(blockSize);
+        float* channels[] = { left.data(), right.data() };
+
+        double best = 0.0;
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                std::copy_n(sourceLeft.begin() + block * blockSize, blockSize, left.begin());
+                std::copy_n(sourceRight.begin() + block * blockSize, blockSize, right.begin());
+
+                core.process(AudioBufferView(channels, numChannels, blockSize));
+            }
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const double nanoseconds = elapsed.count() * 1.0e9 / (static_cast<double>(numBlocks) * blockSize * numChannels);
+            best = pass == 0 ? nanoseconds : std::min(best, nanoseconds);
+        }
+
+        return best;
+    }
+
+    // Nanoseconds per sample of a kernel called on one block at a time, best of several passes
+    template <typename Kernel>
+    double measureKernel(Kernel&& kernel, double seconds)
+    {
+        const int numCalls = static_cast<int>(seconds * 20000.0);
+
+        double best = 0.0;
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            for (int call = 0; call < numCalls; ++call)
+                kernel(call);
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const double nanoseconds = elapsed.count() * 1.0e9 / (static_cast<double>(numCalls) * blockSize);
+            best = pass == 0 ? nanoseconds : std::min(best, nanoseconds);
+        }
+
+        return best;
+    }
+
+    double measureLfoCurve(SaturatorKernels::Isa isa, double seconds)
+    {
+        const auto lfoCurve = SaturatorKernels::getLfoCurve(isa);
+        const double cyclesPerSample = 0.5 / sampleRate; // The chorus LFO rate
+        std::vector<float> phases(blockSize), values(blockSize);
+
+        return measureKernel([&](int call)
+        {
+            lfoCurve(0.0, static_cast<double>(call) * blockSize, cyclesPerSample, 0.25f,
+                     phases.data(), values.data(), blockSize);
+        }, seconds);
+    }
+
+    double measureMixAndClamp(SaturatorKernels::Isa isa, double seconds)
+    {
+        const auto mixAndClamp = SaturatorKernels::getMixAndClamp(isa);
+        std::vector<float> dry(blockSize), wet(blockSize), mix(blockSize, 0.6f), out(blockSize);
+        for (int i = 0; i < blockSize; ++i)
+        {
+            dry[static_cast<size_t>(i)] = 0.5f * std::sin(0.031f * static_cast<float>(i));
+            wet[static_cast<size_t>(i)] = 0.5f * std::sin(0.017f * static_cast<float>(i));
+        }
+
+        return measureKernel([&](int)
+        {
+            mixAndClamp(dry.data(), wet.data(), mix.data(), out.data(), blockSize);
+        }, seconds);
+    }
+
+    void printKernelRow(const char* label, double lfoCurve, double mixAndClamp)
+    {
+        std::printf("%-24s %8.2f %12.2f ns/sample\n", label, lfoCurve, mixAndClamp);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const double seconds = argc > 1 ? std::max(0.1, std::atof(argv[1])) : 2.0;
+
+    using SaturatorKernels::Isa;
+    const auto autoIsa = SaturatorKernels::resolveIsa(Isa::Auto);
+
+    std::printf("Santa Chorus kernel benchmark: %d channels, %d samples @ %.0f Hz, %.1f s per pass\n",
+                numChannels, blockSize, sampleRate, seconds);
+    std::printf("Auto dispatches to:      %s\n\n", SaturatorKernels::getIsaName(autoIsa));
+
+    const double kernelSeconds = seconds * 0.25;
+    std::printf("Kernels                  LFO curve  mix / clamp\n");
+
+    const double scalarLfo = measureLfoCurve(Isa::Scalar, kernelSeconds);
+    const double scalarMix = measureMixAndClamp(Isa::Scalar, kernelSeconds);
+    printKernelRow("Scalar", scalarLfo, scalarMix);
+
+    for (auto isa : { Isa::SSE2, Isa::AVX2, Isa::AVX512, Isa::NEON })
+        if (SaturatorKernels::isIsaSupported(isa))
+            printKernelRow(SaturatorKernels::getIsaName(isa), measureLfoCurve(isa, kernelSeconds), measureMixAndClamp(isa, kernelSeconds));
+
+    const double autoLfo = measureLfoCurve(Isa::Auto, kernelSeconds);
+    const double autoMix = measureMixAndClamp(Isa::Auto, kernelSeconds);
+    const std::string autoLabel = std::string("Auto (") + SaturatorKernels::getIsaName(autoIsa) + ")";
+    printKernelRow(autoLabel.c_str(), autoLfo, autoMix);
+
+    std::printf("Auto vs Scalar:          %8.2fx %11.2fx\n\n", scalarLfo / autoLfo, scalarMix / autoMix);
+
+    // Scalar runs first and last: a vector variant must not slow down the code that follows it
+    std::printf("ChorusCore (full quality)\n");
+    const double scalar = measure(Isa::Scalar, seconds);
+    std::printf("%-24s %8.1f ns/sample\n", "Scalar", scalar);
+
+    for (auto isa : { Isa::SSE2, Isa::AVX2, Isa::AVX512, Isa::NEON })
+        if (SaturatorKernels::isIsaSupported(isa))
+            std::printf("%-24s %8.1f ns/sample\n", SaturatorKernels::getIsaName(isa), measure(isa, seconds));
+
+    const double automatic = measure(Isa::Auto, seconds);
+    std::printf("%-24s %8.1f ns/sample\n", autoLabel.c_str(), automatic);
+
+    const double scalarAfter = measure(Isa::Scalar, seconds);
+    std::printf("%-24s %8.1f ns/sample\n", "Scalar (after vector)", scalarAfter);
+
+    const bool autoOk = automatic <= scalar * maxSlowdown;
+    const bool scalarOk = scalarAfter <= scalar * maxSlowdown;
+
+    std::printf("\nAuto vs Scalar:          %.2fx %s\n", scalar / automatic, autoOk ? "" : "(REGRESSION: slower than Scalar)");
+    if (!scalarOk)
+        std::printf("Scalar slowed down by %.2fx after the vector variants ran (REGRESSION)\n", scalarAfter / scalar);
+
+    return 0;
+}
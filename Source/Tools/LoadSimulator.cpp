@@ -0,0 +1,357 @@
+// Many-instance load simulator: drives hundreds of SaturVSTProcessor instances from a
+// simulated host audio callback, applies randomized automation on Chorus / Dry-Wet,
+// reloads plugin state mid-run from the "message thread" and reports per-callback
+// latency percentiles, cache misses (Linux perf events) and memory per instance.
+// Needs JUCE; CoreLoadSimulator.cpp is a core-only approximation for machines without it.
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_events/juce_events.h>
+#include "PluginProcessor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#if JUCE_LINUX
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+    struct Options
+    {
+        int numInstances = 200;
+        int blockSize = 256;
+        double sampleRate = 48000.0;
+        double seconds = 10.0;
+        bool realtime = true;     // Pace callbacks like a real audio device
+        juce::int64 seed = 1;
+    };
+
+    Options parseOptions(const juce::StringArray& args)
+    {
+        Options options;
+
+        for (int i = 0; i < args.size(); ++i)
+        {
+            const auto& arg = args[i];
+            const auto next = i + 1 < args.size() ? args[i + 1] : juce::String();
+
+            if (arg == "--instances")      { options.numInstances = juce::jmax(1, next.getIntValue()); ++i; }
+            else if (arg == "--block")     { options.blockSize = juce::jmax(16, next.getIntValue()); ++i; }
+            else if (arg == "--rate")      { options.sampleRate = juce::jmax(8000.0, next.getDoubleValue()); ++i; }
+            else if (arg == "--seconds")   { options.seconds = juce::jmax(0.1, next.getDoubleValue()); ++i; }
+            else if (arg == "--seed")      { options.seed = next.getLargeIntValue(); ++i; }
+            else if (arg == "--fast")      { options.realtime = false; }
+        }
+
+        return options;
+    }
+
+    // Resident set size of the whole process in bytes (0 when unavailable)
+    juce::int64 getResidentBytes()
+    {
+       #if JUCE_LINUX
+        long totalPages = 0, residentPages = 0;
+        if (auto* statm = std::fopen("/proc/self/statm", "r"))
+        {
+            if (std::fscanf(statm, "%ld %ld", &totalPages, &residentPages) != 2)
+                residentPages = 0;
+            std::fclose(statm);
+        }
+        return static_cast<juce::int64>(residentPages) * sysconf(_SC_PAGESIZE);
+       #elif JUCE_MAC
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+            return 0;
+        return static_cast<juce::int64>(info.resident_size);
+       #else
+        return 0;
+       #endif
+    }
+
+    // Hardware cache counter for the calling thread (perf events, Linux only)
+    class CacheCounter
+    {
+    public:
+        explicit CacheCounter(int config)
+        {
+           #if JUCE_LINUX
+            perf_event_attr attr {};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = static_cast<__u64>(config);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+           #else
+            juce::ignoreUnused(config);
+           #endif
+        }
+
+        ~CacheCounter()
+        {
+           #if JUCE_LINUX
+            if (fd >= 0)
+                close(fd);
+           #endif
+        }
+
+        bool isAvailable() const { return fd >= 0; }
+
+        void start()
+        {
+           #if JUCE_LINUX
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+           #endif
+        }
+
+        juce::uint64 stop()
+        {
+            juce::uint64 count = 0;
+           #if JUCE_LINUX
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                if (read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count)))
+                    count = 0;
+            }
+           #endif
+            return count;
+        }
+
+    private:
+        int fd = -1;
+    };
+
+   #if JUCE_LINUX
+    constexpr int cacheReferencesEvent = PERF_COUNT_HW_CACHE_REFERENCES;
+    constexpr int cacheMissesEvent = PERF_COUNT_HW_CACHE_MISSES;
+   #else
+    constexpr int cacheReferencesEvent = 0;
+    constexpr int cacheMissesEvent = 0;
+   #endif
+
+    // Host-style automation: set the value, then notify listeners like the plugin wrappers do
+    void automate(juce::RangedAudioParameter* parameter, float normalisedValue)
+    {
+        if (parameter != nullptr)
+        {
+            parameter->setValue(normalisedValue);
+            parameter->sendValueChangedMessageToListeners(normalisedValue);
+        }
+    }
+
+    double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        if (sorted.empty())
+            return 0.0;
+
+        const auto index = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size()))) - 1;
+        return sorted[juce::jlimit<size_t>(0, sorted.size() - 1, index)];
+    }
+
+    struct Instance
+    {
+        std::unique_ptr<SaturVSTProcessor> processor;
+        juce::AudioBuffer<float> buffer;
+        juce::MemoryBlock initialState;
+        juce::RangedAudioParameter* chorus = nullptr;
+        juce::RangedAudioParameter* mix = nullptr;
+        float chorusValue = 0.5f;
+        float mixValue = 0.5f;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    const auto options = parseOptions(args);
+    const int numCallbacks = static_cast<int>(std::ceil(options.seconds * options.sampleRate / options.blockSize));
+    const int reloadCallback = numCallbacks / 2;
+    const double budgetSeconds = options.blockSize / options.sampleRate;
+
+    std::printf("Santa Chorus load simulator: %d instances, %d samples @ %.0f Hz, %.1f s (%s)\n",
+                options.numInstances, options.blockSize, options.sampleRate, options.seconds,
+                options.realtime ? "real-time paced" : "as fast as possible");
+
+    // Instantiate and prepare all instances, measuring the memory they add
+    const auto residentBefore = getResidentBytes();
+
+    std::vector<Instance> instances(static_cast<size_t>(options.numInstances));
+    for (auto& instance : instances)
+    {
+        instance.processor = std::make_unique<SaturVSTProcessor>();
+        instance.processor->setRateAndBufferSizeDetails(options.sampleRate, options.blockSize);
+        instance.processor->prepareToPlay(options.sampleRate, options.blockSize);
+        instance.buffer.setSize(2, options.blockSize);
+        instance.processor->getStateInformation(instance.initialState);
+
+        auto& state = instance.processor->getValueTreeState();
+        instance.chorus = state.getParameter("chorus");
+        instance.mix = state.getParameter("mix");
+    }
+
+    const auto residentAfter = getResidentBytes();
+
+    // Source material shared by all instances, copied in like a host filling its buffers:
+    // one second, and at least two blocks so every callback has a valid offset
+    const int sourceLength = juce::jmax(static_cast<int>(options.sampleRate), 2 * options.blockSize);
+    juce::AudioBuffer<float> source(2, sourceLength);
+    juce::Random sourceRandom(options.seed);
+    for (int ch = 0; ch < 2; ++ch)
+        for (int i = 0; i < sourceLength; ++i)
+            source.setSample(ch, i, 0.3f * std::sin(0.02f * static_cast<float>(i * (ch + 1)))
+                                    + 0.1f * (sourceRandom.nextFloat() * 2.0f - 1.0f));
+
+    std::vector<double> callbackSeconds(static_cast<size_t>(numCallbacks), 0.0);
+    std::atomic<int> callbacksDone{ 0 };
+    std::atomic<bool> reloadStarted{ false };
+    juce::uint64 cacheReferences = 0, cacheMisses = 0;
+    bool cacheCountersAvailable = false;
+    int tierCounts[3] = { 0, 0, 0 };
+    float meanCpuLoad = 0.0f, maxCpuLoad = 0.0f;
+
+    // Simulated host audio thread
+    std::thread audioThread([&]
+    {
+        juce::ScopedNoDenormals noDenormals;
+        juce::MidiBuffer midi;
+        juce::Random automationRandom(options.seed + 1);
+
+        CacheCounter references(cacheReferencesEvent), misses(cacheMissesEvent);
+        cacheCountersAvailable = references.isAvailable() && misses.isAvailable();
+        references.start();
+        misses.start();
+
+        const auto period = std::chrono::duration<double>(budgetSeconds);
+        auto deadline = std::chrono::steady_clock::now();
+
+        for (int callback = 0; callback < numCallbacks; ++callback)
+        {
+            // Without real-time pacing the run can end before the message thread is scheduled,
+            // so the midpoint waits (outside the timed region) until the reload has begun
+            if (callback == reloadCallback && !options.realtime)
+                while (!reloadStarted.load())
+                    std::this_thread::yield();
+
+            const int sourceOffset = (callback * options.blockSize) % (sourceLength - options.blockSize);
+            const auto start = std::chrono::steady_clock::now();
+
+            for (auto& instance : instances)
+            {
+                // Randomized automation: a slow random walk on roughly a quarter of the callbacks
+                if (automationRandom.nextInt(4) == 0)
+                {
+                    instance.chorusValue = juce::jlimit(0.0f, 1.0f, instance.chorusValue + 0.1f * (automationRandom.nextFloat() - 0.5f));
+                    instance.mixValue = juce::jlimit(0.0f, 1.0f, instance.mixValue + 0.1f * (automationRandom.nextFloat() - 0.5f));
+                    automate(instance.chorus, instance.chorusValue);
+                    automate(instance.mix, instance.mixValue);
+                }
+
+                for (int ch = 0; ch < 2; ++ch)
+                    instance.buffer.copyFrom(ch, 0, source, ch, sourceOffset, options.blockSize);
+
+                instance.processor->processBlock(instance.buffer, midi);
+            }
+
+            callbackSeconds[static_cast<size_t>(callback)] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            callbacksDone.store(callback + 1);
+
+            if (options.realtime)
+            {
+                deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+                std::this_thread::sleep_until(deadline);
+            }
+        }
+
+        cacheReferences = references.stop();
+        cacheMisses = misses.stop();
+
+        for (auto& instance : instances)
+        {
+            ++tierCounts[static_cast<int>(instance.processor->getProcessingTier())];
+            meanCpuLoad += instance.processor->getCpuLoad() / static_cast<float>(instances.size());
+            maxCpuLoad = juce::jmax(maxCpuLoad, instance.processor->getCpuLoad());
+        }
+    });
+
+    // Mid-run, the "message thread" reloads every instance's initial state while audio runs
+    while (callbacksDone.load() < reloadCallback)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    reloadStarted.store(true);
+    const int reloadStartCallback = callbacksDone.load();
+    for (auto& instance : instances)
+        instance.processor->setStateInformation(instance.initialState.getData(), static_cast<int>(instance.initialState.getSize()));
+    const int reloadDoneCallback = callbacksDone.load();
+
+    audioThread.join();
+
+    // Report
+    auto sorted = callbackSeconds;
+    std::sort(sorted.begin(), sorted.end());
+    const auto overruns = std::count_if(sorted.begin(), sorted.end(), [&](double s) { return s > budgetSeconds; });
+    const auto toMs = [](double seconds) { return seconds * 1000.0; };
+
+    std::printf("\nKernel variant:          %s\n", SaturatorKernels::getIsaName(instances.front().processor->getActiveKernel()));
+    std::printf("Callback budget:         %.3f ms\n", toMs(budgetSeconds));
+    std::printf("Callback time p50:       %.3f ms\n", toMs(percentile(sorted, 0.50)));
+    std::printf("Callback time p99:       %.3f ms\n", toMs(percentile(sorted, 0.99)));
+    std::printf("Callback time p99.9:     %.3f ms\n", toMs(percentile(sorted, 0.999)));
+    std::printf("Callback time max:       %.3f ms\n", toMs(sorted.back()));
+    std::printf("Jitter (p99.9 - p50):    %.3f ms\n", toMs(percentile(sorted, 0.999) - percentile(sorted, 0.50)));
+    std::printf("Overruns:                %d of %d callbacks\n", static_cast<int>(overruns), numCallbacks);
+
+    if (reloadDoneCallback < numCallbacks)
+        std::printf("State reload:            during callbacks %d-%d\n", reloadStartCallback, reloadDoneCallback);
+    else
+        std::printf("State reload:            started at callback %d, finished after the run (missed it)\n", reloadStartCallback);
+
+    std::printf("Governor tiers at end:   full %d, control-rate %d, minimal %d\n", tierCounts[0], tierCounts[1], tierCounts[2]);
+    std::printf("Governor load at end:    mean %.1f%%, max %.1f%% of the block budget\n",
+                100.0 * meanCpuLoad, 100.0 * maxCpuLoad);
+
+    if (cacheCountersAvailable)
+    {
+        const double instanceBlocks = static_cast<double>(numCallbacks) * options.numInstances;
+        std::printf("Cache misses:            %llu of %llu references (%.1f%%), %.1f per instance block\n",
+                    static_cast<unsigned long long>(cacheMisses), static_cast<unsigned long long>(cacheReferences),
+                    cacheReferences > 0 ? 100.0 * static_cast<double>(cacheMisses) / static_cast<double>(cacheReferences) : 0.0,
+                    static_cast<double>(cacheMisses) / instanceBlocks);
+    }
+    else
+    {
+        std::printf("Cache misses:            unavailable (no perf events)\n");
+    }
+
+    if (residentBefore > 0 && residentAfter > 0)
+        std::printf("Memory per instance:     %.1f KiB resident (%d bytes object)\n",
+                    static_cast<double>(residentAfter - residentBefore) / 1024.0 / options.numInstances,
+                    static_cast<int>(sizeof(SaturVSTProcessor)));
+    else
+        std::printf("Memory per instance:     unavailable (%d bytes object)\n", static_cast<int>(sizeof(SaturVSTProcessor)));
+
+    instances.clear();
+    return 0;
+}